@@ -100,8 +100,9 @@
 /* Flags in PTE_SYSCALL may be used in system calls  (Others may not) */
 #define PTE_SYSCALL (PTE_AVAIL | PTE_P | PTE_W | PTE_U)
 
-/* Address in page table or page directory entry */
-#define PTE_ADDR(pte) ((physaddr_t)(pte) & ~(PTE_NX | (PAGE_SIZE - 1)))
+/* Address in page table or page directory entry
+ * (bits 52-62 are ignored by the MMU and available for software too) */
+#define PTE_ADDR(pte) ((physaddr_t)(pte) & 0x000FFFFFFFFFF000ULL)
 
 
 /* Control Register flags */
@@ -14,6 +14,21 @@ int getchar(void);
 int iscons(int fd);
 
 /* lib/printfmt.c */
+
+/* Formatting output: characters are collected in buf and passed to
+ * flush() in chunks, the last one when formatting is done. Without
+ * flush() output that doesn't fit is counted and dropped. */
+struct fmtbuf {
+    char *buf;
+    size_t size;
+    size_t pos;
+    size_t count; /* characters produced, flushed and dropped ones too */
+    void (*flush)(struct fmtbuf *out); /* takes buf[0, pos) */
+    void *arg;
+};
+
+/* Returns the number of characters produced */
+int vbprintfmt(struct fmtbuf *out, const char *fmt, va_list) __attribute__((format(printf, 2, 0)));
 void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) __attribute__((format(printf, 3, 4)));
 void vprintfmt(void (*putch)(int, void *), void *putdat, const char *fmt, va_list) __attribute__((format(printf, 3, 0)));
 int snprintf(char *str, size_t size, const char *fmt, ...) __attribute__((format(printf, 3, 4)));
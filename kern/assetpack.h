@@ -0,0 +1,47 @@
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * Asset pack file format (built by kern/packer.c, linked into the kernel)
+ *
+ * <asset_pack_header>
+ * nentries x <asset_pack_entry>
+ * entry data, each entry compressed on its own
+ *
+ * Every frame of an animation is a separate entry with the same name,
+ * so one frame can be decoded without touching the others.
+ */
+
+#define ASSET_PACK_MAGIC    0x4B4341505346534AULL /* "JOSFPACK" */
+#define ASSET_NAME_LEN      16
+
+#define ASSET_COMP_NONE 0
+#define ASSET_COMP_RLE  1
+
+/**
+ * RLE stream is a sequence of tokens, values are unit bytes long:
+ * 0x80 | (n - 1), value        - value repeated n times (n <= 128)
+ * n - 1, n values              - n literal values (n <= 128)
+ */
+#define ASSET_RLE_RUN     0x80
+#define ASSET_RLE_MAX_LEN 128
+
+struct asset_pack_header {
+    uint64_t magic;         /* should be ASSET_PACK_MAGIC */
+    uint32_t nentries;
+    uint32_t reserved;
+};
+
+struct asset_pack_entry {
+    char name[ASSET_NAME_LEN]; /* zero padded */
+    uint32_t frame;
+    uint16_t width;            /* in pixels, 0 for raw blobs */
+    uint16_t height;
+    uint8_t compression;       /* ASSET_COMP_* */
+    uint8_t unit;              /* RLE value size: 1 for blobs, 4 for pixels */
+    uint16_t reserved;
+    uint32_t offset;           /* from the start of the pack */
+    uint32_t size;             /* stored size */
+    uint32_t raw_size;         /* decoded size */
+};
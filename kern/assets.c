@@ -0,0 +1,182 @@
+/* Asset pack lookup, streaming RLE decoder and decoded frame cache */
+
+#include <inc/assert.h>
+#include <inc/error.h>
+#include <inc/string.h>
+
+#include "assets.h"
+
+extern char __assets_start[];
+extern char __assets_end[];
+
+struct asset_cache_slot {
+    const struct asset_pack_entry *entry;
+    uint64_t last_use;
+    uint64_t data[ASSET_CACHE_SLOT_SIZE / sizeof(uint64_t)];
+};
+
+static struct asset_cache_slot asset_cache[ASSET_CACHE_SLOTS];
+static uint64_t asset_cache_clock;
+
+static const struct asset_pack_header *
+asset_pack(void) {
+    const struct asset_pack_header *header = (const struct asset_pack_header *)__assets_start;
+    static bool is_checked = false;
+
+    if (!is_checked) {
+        size_t size = __assets_end - __assets_start;
+        const struct asset_pack_entry *entries = (const struct asset_pack_entry *)(header + 1);
+
+        if (size < sizeof(*header) || header->magic != ASSET_PACK_MAGIC ||
+            sizeof(*header) + header->nentries * sizeof(*entries) > size) {
+            panic("Asset pack is corrupt");
+        }
+        for (uint32_t i = 0; i < header->nentries; i++) {
+            if ((uint64_t)entries[i].offset + entries[i].size > size || !entries[i].unit) {
+                panic("Asset pack entry %u is corrupt", i);
+            }
+        }
+        is_checked = true;
+    }
+
+    return header;
+}
+
+const struct asset_pack_entry *
+asset_find(const char *name, uint32_t frame) {
+    const struct asset_pack_header *header = asset_pack();
+    const struct asset_pack_entry *entries = (const struct asset_pack_entry *)(header + 1);
+
+    for (uint32_t i = 0; i < header->nentries; i++) {
+        if (entries[i].frame == frame && !strncmp(entries[i].name, name, ASSET_NAME_LEN)) {
+            return &entries[i];
+        }
+    }
+    return NULL;
+}
+
+uint32_t
+asset_frames(const char *name) {
+    uint32_t n = 0;
+
+    while (asset_find(name, n)) n++;
+    return n;
+}
+
+void
+asset_stream_open(struct asset_stream *stream, const struct asset_pack_entry *entry) {
+    memset(stream, 0, sizeof(*stream));
+
+    stream->entry = entry;
+    stream->src = (const uint8_t *)asset_pack() + entry->offset;
+    stream->end = stream->src + entry->size;
+}
+
+size_t
+asset_stream_read(struct asset_stream *stream, void *dst, size_t size) {
+    const struct asset_pack_entry *entry = stream->entry;
+    uint8_t *out = dst;
+    size_t unit = entry->unit;
+
+    assert(size % unit == 0);
+
+    if (entry->compression == ASSET_COMP_NONE) {
+        size = MIN(size, (size_t)(stream->end - stream->src));
+        memcpy(out, stream->src, size);
+        stream->src += size;
+        return size;
+    }
+
+    while (size) {
+        if (!stream->left) {
+            if (stream->src >= stream->end) {
+                break;
+            }
+
+            uint8_t token = *stream->src++;
+            stream->run = token & ASSET_RLE_RUN;
+            stream->left = (token & ~ASSET_RLE_RUN) + 1;
+            stream->value = stream->src;
+
+            /* truncated token, stop here */
+            size_t token_size = stream->run ? unit : stream->left * unit;
+            if (token_size > (size_t)(stream->end - stream->src)) {
+                stream->left = 0;
+                stream->src = stream->end;
+                break;
+            }
+            stream->src += token_size;
+        }
+
+        size_t n = MIN(stream->left, size / unit);
+        if (stream->run) {
+            if (unit == 1) {
+                memset(out, *stream->value, n);
+            } else if (unit == sizeof(uint32_t)) {
+                uint32_t value;
+                memcpy(&value, stream->value, sizeof(value));
+                for (size_t i = 0; i < n; i++) {
+                    memcpy(out + i * unit, &value, sizeof(value));
+                }
+            } else {
+                for (size_t i = 0; i < n; i++) {
+                    memcpy(out + i * unit, stream->value, unit);
+                }
+            }
+        } else {
+            memcpy(out, stream->value, n * unit);
+            stream->value += n * unit;
+        }
+
+        stream->left -= n;
+        out += n * unit;
+        size -= n * unit;
+    }
+
+    return out - (uint8_t *)dst;
+}
+
+int
+asset_read(const struct asset_pack_entry *entry, void *dst, size_t size) {
+    struct asset_stream stream;
+
+    if (entry->raw_size > size) {
+        return -E_INVAL;
+    }
+
+    asset_stream_open(&stream, entry);
+    if (asset_stream_read(&stream, dst, entry->raw_size) != entry->raw_size) {
+        return -E_INVAL;
+    }
+    return 0;
+}
+
+const void *
+asset_frame(const struct asset_pack_entry *entry) {
+    /* stored as is, use it in place */
+    if (entry->compression == ASSET_COMP_NONE) {
+        return (const uint8_t *)asset_pack() + entry->offset;
+    }
+
+    struct asset_cache_slot *victim = asset_cache;
+    asset_cache_clock++;
+
+    for (int i = 0; i < ASSET_CACHE_SLOTS; i++) {
+        if (asset_cache[i].entry == entry) {
+            asset_cache[i].last_use = asset_cache_clock;
+            return asset_cache[i].data;
+        }
+        if (asset_cache[i].last_use < victim->last_use) {
+            victim = &asset_cache[i];
+        }
+    }
+
+    victim->entry = NULL;
+    if (asset_read(entry, victim->data, sizeof(victim->data)) < 0) {
+        panic("Asset '%.16s' frame %u doesn't fit into frame cache", entry->name, entry->frame);
+    }
+
+    victim->entry = entry;
+    victim->last_use = asset_cache_clock;
+    return victim->data;
+}
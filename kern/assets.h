@@ -0,0 +1,41 @@
+#pragma once
+
+#include <inc/types.h>
+
+#include "assetpack.h"
+
+/**
+ * Access to the asset pack linked into the kernel (see kern/assetpack.h).
+ *
+ * Entries are decoded with a streaming decoder, so nothing needs a buffer
+ * for the whole compressed entry. Frames that are drawn repeatedly go
+ * through a small LRU cache of decoded frames.
+ */
+
+#define ASSET_CACHE_SLOTS     8
+#define ASSET_CACHE_SLOT_SIZE (8 * 1024)
+
+struct asset_stream {
+    const struct asset_pack_entry *entry;
+    const uint8_t *src;
+    const uint8_t *end;
+
+    /* current token */
+    uint32_t left;  /* values left in it */
+    bool run;
+    const uint8_t *value;
+};
+
+/* NULL if there is no such entry */
+const struct asset_pack_entry *asset_find(const char *name, uint32_t frame);
+uint32_t asset_frames(const char *name);
+
+void asset_stream_open(struct asset_stream *stream, const struct asset_pack_entry *entry);
+/* Decode up to size bytes (a multiple of entry unit), returns bytes decoded */
+size_t asset_stream_read(struct asset_stream *stream, void *dst, size_t size);
+
+/* Decode whole entry, -E_INVAL if it doesn't fit or is corrupt */
+int asset_read(const struct asset_pack_entry *entry, void *dst, size_t size);
+
+/* Decoded entry through the frame cache, valid until the next asset_frame() call */
+const void *asset_frame(const struct asset_pack_entry *entry);
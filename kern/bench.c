@@ -0,0 +1,76 @@
+/* Microbenchmark harness, see bench.h */
+
+#include <inc/assert.h>
+#include <inc/stdio.h>
+#include <inc/x86.h>
+
+#include "bench.h"
+#include "timer.h"
+
+static uint64_t bench_samples[BENCH_MAX_SAMPLES];
+
+uint64_t
+bench_cpu_freq(void) {
+    static uint64_t cpu_freq = 0;
+
+    if (!cpu_freq) {
+        cpu_freq = timer_for_schedule->get_cpu_freq();
+    }
+    return cpu_freq;
+}
+
+static void
+sort_samples(uint64_t *samples, uint32_t n) {
+    for (uint32_t i = 1; i < n; i++) {
+        uint64_t sample = samples[i];
+        uint32_t j = i;
+
+        for (; j > 0 && samples[j - 1] > sample; j--) {
+            samples[j] = samples[j - 1];
+        }
+        samples[j] = sample;
+    }
+}
+
+void
+bench_run(struct bench_result *res, const char *name, bench_fn fn, void *arg,
+          uint32_t iters, uint64_t pixels) {
+    assert(iters > 0 && iters <= BENCH_MAX_SAMPLES);
+
+    for (uint32_t i = 0; i < BENCH_WARMUP; i++) {
+        fn(arg, i);
+    }
+
+    for (uint32_t i = 0; i < iters; i++) {
+        uint64_t start = read_tsc();
+        fn(arg, BENCH_WARMUP + i);
+        bench_samples[i] = read_tsc() - start;
+    }
+
+    sort_samples(bench_samples, iters);
+
+    res->name = name;
+    res->iters = iters;
+    res->pixels = pixels;
+    res->min = bench_samples[0];
+    res->median = bench_samples[iters / 2];
+    res->p99 = bench_samples[(iters * 99) / 100];
+}
+
+void
+bench_report(const char *tag, const struct bench_result *res) {
+    uint64_t freq = bench_cpu_freq();
+    uint64_t median = res->median ? res->median : 1;
+    uint64_t median_ns = freq ? median * 1000000000 / freq : 0;
+
+    cprintf("%s: op=%s iters=%u px=%lu median_cyc=%lu p99_cyc=%lu median_ns=%lu",
+            tag, res->name, res->iters, (unsigned long)res->pixels,
+            (unsigned long)res->median, (unsigned long)res->p99, (unsigned long)median_ns);
+
+    if (res->pixels) {
+        /* Mpixels/s with two decimals */
+        uint64_t mpix = res->pixels * freq / median / 10000;
+        cprintf(" mpix_s=%lu.%02lu", (unsigned long)(mpix / 100), (unsigned long)(mpix % 100));
+    }
+    cprintf("\n");
+}
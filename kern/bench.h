@@ -0,0 +1,52 @@
+#pragma once
+
+#include <inc/types.h>
+
+/**
+ * Microbenchmark harness.
+ *
+ * bench_run() calls the benchmarked function BENCH_WARMUP times to warm
+ * caches, then takes one TSC sample per call. Results are reported as
+ * the median and the 99th percentile of the samples, so a stray timer
+ * interrupt doesn't skew them.
+ *
+ * bench_report() prints one line per result, with space separated
+ * key=value fields after the tag, e.g.
+ *
+ *   gfxbench: op=clear iters=100 px=786432 median_cyc=... p99_cyc=... median_ns=... mpix_s=412.07
+ *
+ * so results can be collected from the serial log by grade-bench, which
+ * runs any of the benchmarks by tag.
+ */
+
+#define BENCH_WARMUP      8
+#define BENCH_MAX_SAMPLES 1024
+
+/* iteration is the sample number, counting warmup ones */
+typedef void (*bench_fn)(void *arg, uint32_t iteration);
+
+struct bench_result {
+    const char *name;
+    uint32_t iters;
+    uint64_t pixels; /* per iteration, 0 if it's not a pixel op */
+    uint64_t median; /* in TSC cycles */
+    uint64_t p99;
+    uint64_t min;
+};
+
+/* TSC frequency, calibrated once */
+uint64_t bench_cpu_freq(void);
+
+void bench_run(struct bench_result *res, const char *name, bench_fn fn, void *arg,
+               uint32_t iters, uint64_t pixels);
+void bench_report(const char *tag, const struct bench_result *res);
+
+/* Graphics benchmark suite behind the gfxbench monitor command,
+ * runs ops whose name starts with filter (all if NULL) */
+int gfxbench(uint32_t iters, const char *filter);
+
+/* snprintf() with common kernel format strings, behind fmtbench */
+int fmtbench(uint32_t iters);
+
+/* map_region()/unmap_region() with each page size and TLB misses, behind mapbench */
+int mapbench(uint32_t iters);
@@ -9,8 +9,12 @@
 #include <inc/x86.h>
 
 #include <kern/console.h>
+#include <kern/gpucons.h>
+#include <kern/klog.h>
 #include <kern/picirq.h>
 #include <kern/pmap.h>
+#include <kern/trace.h>
+#include <kern/tsc.h>
 
 #define COM1 0x3F8
 
@@ -22,6 +26,10 @@
 #define COM_IER_RDI   0x01 /*     Enable receiver data interrupt */
 #define COM_IIR       2    /* IN:  Interrupt ID Register */
 #define COM_FCR       2    /* OUT: FIFO Control Register */
+#define COM_FCR_FIFO  0x01 /*     Enable FIFOs */
+#define COM_FCR_CLRX  0x02 /*     Clear receive FIFO */
+#define COM_FCR_CLTX  0x04 /*     Clear transmit FIFO */
+#define COM_TX_FIFO   16   /*     Transmit FIFO size of a 16550A */
 #define COM_LCR       3    /* OUT: Line Control Register */
 #define COM_LCR_DLAB  0x80 /*     Divisor latch access bit */
 #define COM_LCR_WLEN8 0x03 /*     Wordlength: 8 bits */
@@ -43,7 +51,7 @@ static uint32_t uefi_stride;
 static uint32_t crt_rows;
 static uint32_t crt_cols;
 static uint32_t crt_size;
-static uint16_t crt_pos;
+static uint32_t crt_pos;
 static uint32_t *crt_buf = (uint32_t *)FRAMEBUFFER;
 
 static bool serial_exists;
@@ -196,17 +204,91 @@ draw_char(uint32_t *buffer, uint32_t x, uint32_t y, uint32_t color, uint8_t char
     }
 }
 
+/* Ring scrolling
+ *
+ * Moving the whole framebuffer up by a line costs a read and a write of
+ * every pixel, for every line. Instead, the line that scrolls out is
+ * reused for the new one: text row y is drawn at framebuffer row
+ * (fb_top + y) % crt_rows, and a rule on the blank pixels of the top
+ * line of the oldest row marks where the newest one ends. Text is kept
+ * in crt_cells, so the rows are put back in order by fb_unroll() when
+ * the console waits for input; after a screenful of lines the ring
+ * wraps around into order by itself. */
+
+#define CRT_MAX_ROWS  272
+#define CRT_MAX_COLS  480
+#define FB_TEXT_COLOR 0xFFFFFFFF
+#define FB_RULE_COLOR 0x00808080
+
+static uint32_t fb_top;    /* framebuffer row of text row 0 */
+static uint32_t cells_top; /* crt_cells line of text row 0 */
+static uint8_t crt_cells[CRT_MAX_ROWS][CRT_MAX_COLS];
+
+static uint8_t *
+fb_line(uint32_t row) {
+    return crt_cells[(cells_top + row) % crt_rows];
+}
+
+static uint32_t *
+fb_row_pixels(uint32_t row) {
+    return crt_buf + uefi_stride * SYMBOL_SIZE * ((fb_top + row) % crt_rows);
+}
+
+static void
+fb_draw_cell(uint32_t pos, uint8_t c) {
+    uint32_t row = pos / crt_cols;
+
+    fb_line(row)[pos % crt_cols] = c;
+    draw_char(crt_buf, pos % crt_cols, (fb_top + row) % crt_rows, FB_TEXT_COLOR, c);
+}
+
+/* Redraw all rows in order */
+static void
+fb_unroll(void) {
+    if (!fb_top) return;
+
+    fb_top = 0;
+    for (uint32_t row = 0; row < crt_rows; row++) {
+        uint8_t *line = fb_line(row);
+        for (uint32_t col = 0; col < crt_cols; col++) {
+            draw_char(crt_buf, col, row, FB_TEXT_COLOR, line[col]);
+        }
+    }
+}
+
+static void
+fb_scroll(void) {
+    cells_top = (cells_top + 1) % crt_rows;
+    memset(fb_line(crt_rows - 1), 0, crt_cols);
+    crt_pos -= crt_cols;
+
+    /* the oldest row becomes the newest one, the rule moves down with it */
+    fb_top = (fb_top + 1) % crt_rows;
+    nosan_memset(fb_row_pixels(crt_rows - 1), 0, uefi_stride * SYMBOL_SIZE * sizeof(uint32_t));
+
+    if (fb_top) {
+        /* keep the glyph pixels of the oldest row */
+        uint32_t *rule = fb_row_pixels(0);
+        for (uint32_t x = 0; x < crt_cols * SYMBOL_SIZE; x++) {
+            if (!rule[x]) rule[x] = FB_RULE_COLOR;
+        }
+    }
+}
+
 void
 fb_init(void) {
     LOADER_PARAMS *lp = (LOADER_PARAMS *)uefi_lp;
     uefi_vres = lp->VerticalResolution;
     uefi_hres = lp->HorizontalResolution;
     uefi_stride = lp->PixelsPerScanLine;
-    crt_rows = uefi_vres / SYMBOL_SIZE;
-    crt_cols = uefi_hres / SYMBOL_SIZE;
+    crt_rows = MIN(uefi_vres / SYMBOL_SIZE, CRT_MAX_ROWS);
+    crt_cols = MIN(uefi_hres / SYMBOL_SIZE, CRT_MAX_COLS);
     crt_size = crt_rows * crt_cols;
     crt_pos = crt_cols;
 
+    /* Booted without a GOP framebuffer */
+    if (!lp->FrameBufferBase || crt_rows < 2 || !crt_cols) return;
+
     /* Clear screen */
     memset(crt_buf, 0, lp->FrameBufferSize);
 
@@ -224,7 +306,7 @@ fb_putc(int c) {
     case '\b':
         if (crt_pos > 0) {
             crt_pos--;
-            draw_char(crt_buf, crt_pos % crt_cols, crt_pos / crt_cols, 0x0, 0x8);
+            fb_draw_cell(crt_pos, 0);
         }
         break;
     case '\n':
@@ -239,19 +321,148 @@ fb_putc(int c) {
         break;
     default:
         /* write the character */
-        draw_char(crt_buf, crt_pos % crt_cols, crt_pos / crt_cols, 0xFFFFFFFF, (uint8_t)c);
+        fb_draw_cell(crt_pos, (uint8_t)c);
         crt_pos++;
     }
 
     /* Scoll up when we have reached the bottom of screen */
     if (crt_pos >= crt_size) {
-        nosan_memmove(crt_buf, crt_buf + uefi_stride * SYMBOL_SIZE,
-                      uefi_stride * (uefi_vres - SYMBOL_SIZE) * sizeof(uint32_t));
+        fb_scroll();
+    }
+}
+
+/* Keyboard events
+ *
+ * Key presses and releases are queued in a ring filled by kbd_intr()
+ * and serial_intr(). The kernel runs with interrupts disabled and
+ * IRQ1/IRQ4 stay masked, so the ring is filled by polling: key_poll()
+ * from pong and cons_getc() from the monitor. Events are stamped when
+ * they are decoded, so they are as precise as the polling rate.
+ * There is a single producer, so the ring needs no lock, only wpos
+ * has to be updated after the entry is written. */
+
+static struct {
+    struct key_event buf[KEY_EVENT_QUEUE_SIZE];
+    uint32_t rpos; /* free running, wrapped on access */
+    uint32_t wpos;
+    uint32_t dropped;
+} key_events;
+
+static uint64_t key_state[256 / 64];
+
+static void
+key_event_put(uint8_t key, bool down) {
+    uint64_t bit = 1ULL << (key % 64);
+
+    if (!key || !(key_state[key / 64] & bit) == !down) return;
+
+    if (down)
+        key_state[key / 64] |= bit;
+    else
+        key_state[key / 64] &= ~bit;
+    TRACE(KEY, key, down);
+
+    /* state is still tracked when the queue is full */
+    if (key_events.wpos - key_events.rpos == KEY_EVENT_QUEUE_SIZE) {
+        key_events.dropped++;
+        return;
+    }
+    key_events.buf[key_events.wpos % KEY_EVENT_QUEUE_SIZE] =
+            (struct key_event){read_tsc(), key, down ? KEY_EVENT_DOWN : 0};
+    asm volatile("" ::: "memory");
+    key_events.wpos++;
+}
+
+bool
+key_event_pop(struct key_event *event) {
+    if (key_events.rpos == key_events.wpos) return false;
+
+    *event = key_events.buf[key_events.rpos % KEY_EVENT_QUEUE_SIZE];
+    asm volatile("" ::: "memory");
+    key_events.rpos++;
+    return true;
+}
+
+void
+key_event_flush(void) {
+    key_events.rpos = key_events.wpos;
+}
+
+bool
+key_pressed(uint8_t key) {
+    return key_state[key / 64] & (1ULL << (key % 64));
+}
+
+/* A terminal sends characters only, so a serial key counts as held
+ * while it keeps repeating. It is released when no repeat arrives
+ * within the typematic delay (or a few repeat periods once it repeats),
+ * or when another key is sent, as terminals only repeat the last key. */
+
+#define SERIAL_KEY_DELAY_MS  550
+#define SERIAL_KEY_REPEAT_MS 100
+
+static struct {
+    int esc; /* bytes of an ESC [ sequence seen */
+    uint8_t key;
+    bool repeating;
+    uint64_t last;
+} serial_key;
+
+static void
+serial_key_timeout(uint64_t now) {
+    uint64_t hold = serial_key.repeating ? SERIAL_KEY_REPEAT_MS : SERIAL_KEY_DELAY_MS;
+
+    if (serial_key.key && now - serial_key.last > tsc_calibrate() / 1000 * hold) {
+        key_event_put(serial_key.key, false);
+        serial_key.key = 0;
+    }
+}
+
+static void
+serial_key_press(uint8_t key) {
+    uint64_t now = read_tsc();
+
+    if (key == serial_key.key) {
+        serial_key.repeating = true;
+    } else {
+        if (serial_key.key) key_event_put(serial_key.key, false);
+        key_event_put(key, true);
+        serial_key.key = key;
+        serial_key.repeating = false;
+    }
+    serial_key.last = now;
+}
 
-        size_t i = (uefi_vres - (uefi_vres % SYMBOL_SIZE) - SYMBOL_SIZE);
-        nosan_memset(crt_buf + i * uefi_stride, 0, uefi_stride * (uefi_vres - i) * sizeof(uint32_t));
-        crt_pos -= crt_cols;
+static void
+serial_key_byte(int c) {
+    static const uint8_t arrows[4] = {KEY_UP, KEY_DN, KEY_RT, KEY_LF};
+
+    if (serial_key.esc == 1) {
+        serial_key.esc = 0;
+        if (c == '[') {
+            serial_key.esc = 2;
+            return;
+        }
+        serial_key_press(033);
+    } else if (serial_key.esc == 2) {
+        serial_key.esc = 0;
+        if (c >= 'A' && c <= 'D') serial_key_press(arrows[c - 'A']);
+        return;
     }
+
+    if (c == 033) {
+        serial_key.esc = 1;
+        return;
+    }
+
+    /* same keys as the keyboard reports */
+    if (c == '\r')
+        c = '\n';
+    else if (c == 0x7F)
+        c = '\b';
+    else if ('A' <= c && c <= 'Z')
+        c += 'a' - 'A';
+    serial_key_press(c);
 }
 
 /* Serial I/O code */
@@ -270,28 +481,88 @@ delay(void) {
 static int
 serial_proc_data(void) {
     if (!(inb(COM1 + COM_LSR) & COM_LSR_DATA)) return -1;
-    return inb(COM1 + COM_RX);
+
+    int c = inb(COM1 + COM_RX);
+    serial_key_byte(c);
+    return c;
+}
+
+/* Transmit ring
+ *
+ * serial_write() copies the whole buffer into the ring and then drains it
+ * one FIFO load per transmitter empty poll, instead of polling COM_LSR
+ * for every byte. The kernel runs with interrupts disabled, so there is
+ * no THR empty interrupt to leave the rest to: the ring is always empty
+ * when serial_write() returns. */
+
+#define SERIAL_TX_SIZE 4096 /* power of two */
+
+static struct {
+    uint8_t buf[SERIAL_TX_SIZE];
+    uint32_t rpos; /* free running, wrapped on access */
+    uint32_t wpos;
+} serial_tx;
+
+/* Writes up to a FIFO load, the transmitter has to be empty */
+static void
+serial_tx_burst(void) {
+    for (int i = 0; i < COM_TX_FIFO && serial_tx.rpos != serial_tx.wpos; i++) {
+        outb(COM1 + COM_TX, serial_tx.buf[serial_tx.rpos++ % SERIAL_TX_SIZE]);
+    }
+}
+
+static void
+serial_tx_flush(void) {
+    while (serial_tx.rpos != serial_tx.wpos) {
+        for (size_t i = 0; i < 12800; i++) {
+            if (inb(COM1 + COM_LSR) & COM_LSR_TXRDY) break;
+            delay();
+        }
+        serial_tx_burst();
+    }
 }
 
 void
 serial_intr(void) {
-    if (serial_exists) cons_intr(serial_proc_data);
+    if (serial_exists) {
+        cons_intr(serial_proc_data);
+        serial_key_timeout(read_tsc());
+    }
 }
 
-static void
-serial_putc(int c) {
-    for (size_t i = 0; i < 12800; i++) {
-        if (inb(COM1 + COM_LSR) & COM_LSR_TXRDY) break;
-        delay();
+void
+serial_write(const char *buf, size_t len) {
+    if (!serial_exists) return;
+
+    while (len) {
+        if (serial_tx.wpos - serial_tx.rpos == SERIAL_TX_SIZE) {
+            serial_tx_flush();
+        }
+
+        uint32_t pos = serial_tx.wpos % SERIAL_TX_SIZE;
+        size_t n = MIN(len, MIN(SERIAL_TX_SIZE - pos, SERIAL_TX_SIZE - (serial_tx.wpos - serial_tx.rpos)));
+        /* characters with codes higher than 127 are not supported, as in cons_putc() */
+        for (size_t i = 0; i < n; i++) {
+            serial_tx.buf[pos + i] = buf[i] & 0x7F;
+        }
+        serial_tx.wpos += n;
+        buf += n;
+        len -= n;
     }
 
-    outb(COM1 + COM_TX, c);
+    serial_tx_flush();
+}
+
+static void
+serial_putc(int c) {
+    char ch = c;
+    serial_write(&ch, 1);
 }
 
 static void
 serial_init(void) {
-    /* Turn off the FIFO */
-    outb(COM1 + COM_FCR, 0);
+    /* Turn on and clear the FIFOs */
+    outb(COM1 + COM_FCR, COM_FCR_FIFO | COM_FCR_CLRX | COM_FCR_CLTX);
 
     /* Set speed; requires DLAB latch */
     outb(COM1 + COM_LCR, COM_LCR_DLAB);
@@ -318,8 +589,18 @@ serial_init(void) {
 /* For information on PC parallel port programming,
  * see the class References page */
 
+/* Status reads as all ones when there is no port */
+static bool lpt_exists;
+
+static void
+lpt_init(void) {
+    lpt_exists = (inb(0x378 + 1) != 0xFF);
+}
+
 static void
 lpt_putc(int c) {
+    if (!lpt_exists) return;
+
     for (size_t i = 0; i < 12800; i++) {
         if (inb(0x378 + 1) & 0x80) break;
         delay();
@@ -442,6 +723,7 @@ kbd_proc_data(void) {
         /* Key released */
         data = (shift & E0ESC ? data : data & 0x7F);
         shift &= ~(shiftcode[data] | E0ESC);
+        key_event_put(normalmap[data], false);
         return 0;
     } else if (shift & E0ESC) {
         /* Last character was an E0 escape; or with 0x80 */
@@ -449,6 +731,8 @@ kbd_proc_data(void) {
         shift &= ~E0ESC;
     }
 
+    key_event_put(normalmap[data], true);
+
     shift |= shiftcode[data];
     shift ^= togglecode[data];
 
@@ -520,6 +804,11 @@ cons_getc(void) {
     serial_intr();
     kbd_intr();
 
+    /* Waiting for input is a good time to show batched output */
+    klog_drain(KLOG_DRAIN_BUDGET);
+    fb_unroll();
+    gpucons_flush();
+
     /* Grab the next character from the input buffer */
     if (cons.rpos != cons.wpos) {
         uint8_t ch = cons.buf[cons.rpos++];
@@ -529,6 +818,12 @@ cons_getc(void) {
     return 0;
 }
 
+void
+key_poll(void) {
+    serial_intr();
+    kbd_intr();
+}
+
 /* Output a character to the console */
 static void
 cons_putc(int c) {
@@ -539,6 +834,19 @@ cons_putc(int c) {
     serial_putc(c);
     lpt_putc(c);
     fb_putc(c);
+    gpucons_putc(c);
+}
+
+void
+cons_write(const char *buf, size_t len) {
+    serial_write(buf, len);
+
+    for (size_t i = 0; i < len; i++) {
+        int c = buf[i] & 0x7F;
+        lpt_putc(c);
+        fb_putc(c);
+        gpucons_putc(c);
+    }
 }
 
 /* Initialize the console devices */
@@ -546,6 +854,7 @@ void
 cons_init(void) {
     kbd_init();
     serial_init();
+    lpt_init();
 
     if (!serial_exists)
         cprintf("Serial port does not exist!\n");
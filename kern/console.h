@@ -16,10 +16,42 @@
 void cons_init(void);
 void fb_init(void);
 int cons_getc(void);
+/* Output len characters, the serial part is a copy into the transmit ring */
+void cons_write(const char *buf, size_t len);
+/* Serial port only, for bulk output meant for the host */
+void serial_write(const char *buf, size_t len);
 
 /* IRQ1 */
 void kbd_intr(void);
 /* IRQ4 */
 void serial_intr(void);
 
+/* Keyboard events
+ *
+ * kbd_intr() and serial_intr() decode input into key press and release
+ * events as well as characters. Events are queued with the TSC of the
+ * moment they were decoded and the state of every key is kept in a
+ * bitmap, so key_pressed() is O(1) and doesn't touch the hardware.
+ * Keys are identified by their unshifted character, or KEY_* from
+ * inc/kbdreg.h for special keys; typematic repeats are not events. */
+
+#define KEY_EVENT_QUEUE_SIZE 128 /* power of two */
+
+/* key_event.flags */
+#define KEY_EVENT_DOWN 0x1
+
+struct key_event {
+    uint64_t tsc;
+    uint8_t key;
+    uint8_t flags;
+};
+
+/* Polls the devices, for when interrupts are disabled */
+void key_poll(void);
+/* Pops the oldest event, returns false if there is none */
+bool key_event_pop(struct key_event *event);
+/* Drops queued events, key state is kept */
+void key_event_flush(void);
+bool key_pressed(uint8_t key);
+
 #endif /* _CONSOLE_H_ */
@@ -0,0 +1,66 @@
+/* CRC32C, see crc32c.h */
+
+#include <inc/x86.h>
+
+#include "crc32c.h"
+
+#define CRC32C_POLY 0x82F63B78 /* reflected */
+
+#define CPUID_1_ECX_SSE42 (1 << 20)
+
+static uint32_t crc32c_table[256];
+
+static uint32_t
+crc32c_sw(uint32_t crc, const uint8_t *data, size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        crc = crc32c_table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return crc;
+}
+
+static uint32_t
+crc32c_hw(uint32_t crc, const uint8_t *data, size_t size) {
+    uint64_t crc64 = crc;
+
+    for (; size && ((uintptr_t)data & 7); size--) {
+        asm("crc32b %1, %k0"
+            : "+r"(crc64)
+            : "rm"(*data++));
+    }
+    for (; size >= 8; size -= 8, data += 8) {
+        asm("crc32q %1, %0"
+            : "+r"(crc64)
+            : "rm"(*(const uint64_t *)data));
+    }
+    for (; size; size--) {
+        asm("crc32b %1, %k0"
+            : "+r"(crc64)
+            : "rm"(*data++));
+    }
+
+    return crc64;
+}
+
+uint32_t
+crc32c(uint32_t crc, const void *data, size_t size) {
+    static enum { UNKNOWN, HARDWARE, SOFTWARE } impl = UNKNOWN;
+
+    if (impl == UNKNOWN) {
+        uint32_t ecx;
+        cpuid(1, NULL, NULL, &ecx, NULL);
+
+        for (uint32_t i = 0; i < 256; i++) {
+            uint32_t entry = i;
+            for (int bit = 0; bit < 8; bit++) {
+                entry = (entry >> 1) ^ (entry & 1 ? CRC32C_POLY : 0);
+            }
+            crc32c_table[i] = entry;
+        }
+
+        impl = ecx & CPUID_1_ECX_SSE42 ? HARDWARE : SOFTWARE;
+    }
+
+    crc = ~crc;
+    crc = impl == HARDWARE ? crc32c_hw(crc, data, size) : crc32c_sw(crc, data, size);
+    return ~crc;
+}
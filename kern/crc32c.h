@@ -0,0 +1,16 @@
+#pragma once
+
+#include <inc/types.h>
+
+/**
+ * CRC32C (Castagnoli), as used by iSCSI and ext4.
+ *
+ * Uses the SSE4.2 crc32 instruction when the CPU has it (it works on
+ * general purpose registers, so it's fine with -mno-sse), a byte-wise
+ * table otherwise. Both give the same result.
+ *
+ * crc32c(0, "123456789", 9) == 0xE3069283
+ */
+
+/* Continue crc over data, start with crc = 0 */
+uint32_t crc32c(uint32_t crc, const void *data, size_t size);
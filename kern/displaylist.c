@@ -0,0 +1,356 @@
+/* Retained display list with tile binned rasterization, see displaylist.h */
+
+#include <inc/string.h>
+#include <inc/stdio.h>
+
+#include "displaylist.h"
+#include "profiler.h"
+
+#define FNV_OFFSET 0xcbf29ce484222325ULL
+#define FNV_PRIME  0x100000001b3ULL
+
+static uint64_t
+hash_bytes(uint64_t hash, const void *data, size_t size) {
+    const uint8_t *bytes = data;
+
+    while (size--) {
+        hash = (hash ^ *bytes++) * FNV_PRIME;
+    }
+    return hash;
+}
+
+void
+dl_invalidate(struct display_list *dl) {
+    dl->valid = false;
+}
+
+void
+dl_begin(struct display_list *dl, struct surface_t *surface, uint32_t clear_color) {
+    /* surface_init() gives a fresh resource, nothing on the host is retained */
+    if (dl->surface != surface || dl->resource_id != surface->resource_id) {
+        dl->valid = false;
+    }
+
+    dl->surface = surface;
+    dl->resource_id = surface->resource_id;
+    dl->clear_color = clear_color;
+    dl->ncmds = 0;
+}
+
+static struct dl_cmd *
+dl_push(struct display_list *dl, enum dl_op op, const rect_t *rect, uint32_t color) {
+    if (dl->ncmds == DL_MAX_CMDS) {
+        cprintf("%s: display list is full\n", __func__);
+        return NULL;
+    }
+
+    struct dl_cmd *cmd = &dl->cmds[dl->ncmds++];
+    memset(cmd, 0, sizeof(*cmd));
+    cmd->op = op;
+    cmd->rect = *rect;
+    cmd->color = color;
+    return cmd;
+}
+
+void
+dl_fill_rect(struct display_list *dl, const rect_t *rect, uint32_t color) {
+    dl_push(dl, DL_FILL, rect, color);
+}
+
+void
+dl_fill_texture(struct display_list *dl, const rect_t *rect, uint32_t *texture, int y_mirror, uint32_t extra_color) {
+    struct dl_cmd *cmd = dl_push(dl, DL_TEXTURE, rect, extra_color);
+    if (cmd) {
+        cmd->texture.texture = texture;
+        cmd->texture.y_mirror = y_mirror;
+    }
+}
+
+void
+dl_draw_text(struct display_list *dl, struct font_t *font, const char *str, uint32_t x, uint32_t y, uint32_t color) {
+    uint32_t len = strlen(str);
+    rect_t rect = {x, y, len * font->char_width, font->char_height};
+
+    struct dl_cmd *cmd = dl_push(dl, DL_TEXT, &rect, color);
+    if (cmd) {
+        cmd->text.font = font;
+        cmd->text.str = str;
+        cmd->text.len = len;
+    }
+}
+
+void
+dl_draw_circle(struct display_list *dl, uint32_t x, uint32_t y, uint32_t r, uint32_t color) {
+    rect_t rect = {x - r, y - r, 2 * r + 1, 2 * r + 1};
+
+    struct dl_cmd *cmd = dl_push(dl, DL_CIRCLE, &rect, color);
+    if (cmd) {
+        cmd->circle.r = r;
+    }
+}
+
+void
+dl_draw_sprites(struct display_list *dl, const struct sprite_atlas *atlas, struct sprite_draw *draws, size_t n) {
+    rect_t rect;
+    if (!sprite_batch_bounds(atlas, draws, n, &rect)) {
+        return;
+    }
+
+    sprite_batch_sort(draws, n);
+
+    struct dl_cmd *cmd = dl_push(dl, DL_SPRITES, &rect, 0);
+    if (cmd) {
+        cmd->sprites.atlas = atlas;
+        cmd->sprites.draws = draws;
+        cmd->sprites.n = n;
+    }
+}
+
+void
+dl_fill_rects(struct display_list *dl, const rect_t *rects, const uint32_t *colors, size_t n) {
+    int64_t x0 = INT64_MAX, y0 = INT64_MAX, x1 = INT64_MIN, y1 = INT64_MIN;
+
+    for (size_t i = 0; i < n; i++) {
+        x0 = MIN(x0, (int64_t)(int32_t)rects[i].x);
+        y0 = MIN(y0, (int64_t)(int32_t)rects[i].y);
+        x1 = MAX(x1, (int64_t)(int32_t)rects[i].x + rects[i].width);
+        y1 = MAX(y1, (int64_t)(int32_t)rects[i].y + rects[i].height);
+    }
+    if (x0 >= x1) {
+        return;
+    }
+
+    rect_t rect = {x0, y0, x1 - x0, y1 - y0};
+    struct dl_cmd *cmd = dl_push(dl, DL_RECTS, &rect, 0);
+    if (cmd) {
+        cmd->rects.rects = rects;
+        cmd->rects.colors = colors;
+        cmd->rects.n = n;
+    }
+}
+
+static uint64_t
+dl_cmd_hash(const struct dl_cmd *cmd) {
+    if (cmd->op == DL_RECTS) {
+        /* rects are hashed per tile by dl_bin_rects(), leave out the bounding box */
+        struct dl_cmd head = *cmd;
+        head.rect = (rect_t){0};
+        return hash_bytes(FNV_OFFSET, &head, sizeof(head));
+    }
+
+    /* the union is zeroed by dl_push(), so hashing it whole is stable */
+    uint64_t hash = hash_bytes(FNV_OFFSET, cmd, sizeof(*cmd));
+
+    if (cmd->op == DL_TEXT) {
+        hash = hash_bytes(hash, cmd->text.str, cmd->text.len);
+    } else if (cmd->op == DL_SPRITES) {
+        hash = hash_bytes(hash, cmd->sprites.draws, cmd->sprites.n * sizeof(*cmd->sprites.draws));
+    }
+    return hash;
+}
+
+static void
+dl_execute_rects(struct surface_t *surface, const struct dl_cmd *cmd) {
+    int32_t clip_x1 = surface->clip.x + surface->clip.width;
+    int32_t clip_y1 = surface->clip.y + surface->clip.height;
+
+    for (uint32_t i = 0; i < cmd->rects.n; i++) {
+        const rect_t *rect = &cmd->rects.rects[i];
+        int32_t x = rect->x, y = rect->y;
+
+        /* most of a big batch misses the tile, skip it here */
+        if (x >= clip_x1 || y >= clip_y1 ||
+            x + (int32_t)rect->width <= (int32_t)surface->clip.x ||
+            y + (int32_t)rect->height <= (int32_t)surface->clip.y) {
+            continue;
+        }
+        surface_fill_rect(surface, rect, cmd->rects.colors[i]);
+    }
+}
+
+static void
+dl_execute(struct surface_t *surface, const struct dl_cmd *cmd) {
+    switch (cmd->op) {
+    case DL_FILL:
+        surface_fill_rect(surface, &cmd->rect, cmd->color);
+        break;
+    case DL_TEXTURE:
+        surface_fill_texture(surface, &cmd->rect, cmd->texture.texture, cmd->texture.y_mirror, cmd->color);
+        break;
+    case DL_TEXT:
+        surface_draw_text_run(surface, cmd->text.font, cmd->text.str, cmd->text.len,
+                              cmd->rect.x, cmd->rect.y, cmd->color);
+        break;
+    case DL_CIRCLE:
+        surface_draw_circle(surface, cmd->rect.x + cmd->circle.r, cmd->rect.y + cmd->circle.r,
+                            cmd->circle.r, cmd->color);
+        break;
+    case DL_SPRITES:
+        sprite_batch_draw_sorted(surface, cmd->sprites.atlas, cmd->sprites.draws, cmd->sprites.n);
+        break;
+    case DL_RECTS:
+        dl_execute_rects(surface, cmd);
+        break;
+    }
+}
+
+/* Bin a rect batch rect by rect, so tiles between the rects stay clean.
+ * Every rect adds its own hash to the tiles it overlaps, the rect and
+ * command indices keep the sum dependent on the drawing order. */
+static void
+dl_bin_rects(struct display_list *dl, uint32_t index) {
+    const struct dl_cmd *cmd = &dl->cmds[index];
+
+    for (uint32_t i = 0; i < cmd->rects.n; i++) {
+        rect_t rect;
+        if (!surface_clip_rect(dl->surface, &cmd->rects.rects[i], &rect)) {
+            continue;
+        }
+
+        uint64_t hash = hash_bytes(FNV_OFFSET, &index, sizeof(index));
+        hash = hash_bytes(hash, &i, sizeof(i));
+        hash = hash_bytes(hash, &cmd->rects.rects[i], sizeof(cmd->rects.rects[i]));
+        hash = hash_bytes(hash, &cmd->rects.colors[i], sizeof(cmd->rects.colors[i]));
+
+        uint32_t tx1 = (rect.x + rect.width - 1) / DL_TILE_SIZE;
+        uint32_t ty1 = (rect.y + rect.height - 1) / DL_TILE_SIZE;
+
+        for (uint32_t ty = rect.y / DL_TILE_SIZE; ty <= ty1; ty++) {
+            for (uint32_t tx = rect.x / DL_TILE_SIZE; tx <= tx1; tx++) {
+                dl->bins[ty][tx][index / 64] |= 1ULL << (index % 64);
+                dl->rects_hash[ty][tx] += hash;
+            }
+        }
+    }
+}
+
+/* Set bin bits for every tile the command overlaps */
+static void
+dl_bin(struct display_list *dl, uint32_t index) {
+    if (dl->cmds[index].op == DL_RECTS) {
+        dl_bin_rects(dl, index);
+        return;
+    }
+
+    rect_t rect;
+    if (!surface_clip_rect(dl->surface, &dl->cmds[index].rect, &rect)) {
+        return;
+    }
+
+    uint32_t tx1 = (rect.x + rect.width - 1) / DL_TILE_SIZE;
+    uint32_t ty1 = (rect.y + rect.height - 1) / DL_TILE_SIZE;
+
+    for (uint32_t ty = rect.y / DL_TILE_SIZE; ty <= ty1; ty++) {
+        for (uint32_t tx = rect.x / DL_TILE_SIZE; tx <= tx1; tx++) {
+            dl->bins[ty][tx][index / 64] |= 1ULL << (index % 64);
+        }
+    }
+}
+
+static void
+rect_union(rect_t *box, const rect_t *rect) {
+    uint32_t x0 = MIN(box->x, rect->x);
+    uint32_t y0 = MIN(box->y, rect->y);
+
+    box->width = MAX(box->x + box->width, rect->x + rect->width) - x0;
+    box->height = MAX(box->y + box->height, rect->y + rect->height) - y0;
+    box->x = x0;
+    box->y = y0;
+}
+
+static void
+dl_add_damage(struct display_list *dl, const rect_t *rect) {
+    /* extend a rect from the previous tile row with the same columns */
+    for (uint32_t i = 0; i < dl->ndamage; i++) {
+        rect_t *damage = &dl->damage[i];
+        if (damage->x == rect->x && damage->width == rect->width &&
+            damage->y + damage->height == rect->y) {
+            damage->height += rect->height;
+            return;
+        }
+    }
+
+    if (dl->ndamage < DL_MAX_DAMAGE) {
+        dl->damage[dl->ndamage++] = *rect;
+        return;
+    }
+
+    /* too many rects, fall back to one bounding box */
+    for (uint32_t i = 1; i < dl->ndamage; i++) {
+        rect_union(&dl->damage[0], &dl->damage[i]);
+    }
+    rect_union(&dl->damage[0], rect);
+    dl->ndamage = 1;
+}
+
+void
+dl_end(struct display_list *dl) {
+    struct surface_t *surface = dl->surface;
+    uint32_t tiles_x = (surface->width + DL_TILE_SIZE - 1) / DL_TILE_SIZE;
+    uint32_t tiles_y = (surface->height + DL_TILE_SIZE - 1) / DL_TILE_SIZE;
+    uint32_t nwords = (dl->ncmds + 63) / 64;
+
+    assert(tiles_x <= DL_TILES_X && tiles_y <= DL_TILES_Y);
+
+    memset(dl->bins, 0, sizeof(dl->bins));
+    memset(dl->rects_hash, 0, sizeof(dl->rects_hash));
+    for (uint32_t i = 0; i < dl->ncmds; i++) {
+        dl->cmd_hash[i] = dl_cmd_hash(&dl->cmds[i]);
+        dl_bin(dl, i);
+    }
+
+    dl->tiles_drawn = 0;
+    dl->ndamage = 0;
+
+    uint64_t raster_start = prof_start();
+
+    for (uint32_t ty = 0; ty < tiles_y; ty++) {
+        rect_t run = {0, ty * DL_TILE_SIZE, 0, MIN(DL_TILE_SIZE, surface->height - ty * DL_TILE_SIZE)};
+
+        for (uint32_t tx = 0; tx < tiles_x; tx++) {
+            uint64_t *bin = dl->bins[ty][tx];
+            uint64_t hash = hash_bytes(FNV_OFFSET, &dl->clear_color, sizeof(dl->clear_color));
+
+            for (uint32_t w = 0; w < nwords; w++) {
+                for (uint64_t bits = bin[w]; bits; bits &= bits - 1) {
+                    hash = (hash ^ dl->cmd_hash[w * 64 + __builtin_ctzll(bits)]) * FNV_PRIME;
+                }
+            }
+            hash = (hash ^ dl->rects_hash[ty][tx]) * FNV_PRIME;
+
+            bool dirty = !dl->valid || hash != dl->tile_hash[ty][tx];
+            dl->tile_hash[ty][tx] = hash;
+
+            if (dirty) {
+                rect_t tile = {tx * DL_TILE_SIZE, run.y, MIN(DL_TILE_SIZE, surface->width - tx * DL_TILE_SIZE), run.height};
+
+                surface_set_clip(surface, &tile);
+                surface_fill_rect(surface, &tile, dl->clear_color);
+                for (uint32_t w = 0; w < nwords; w++) {
+                    for (uint64_t bits = bin[w]; bits; bits &= bits - 1) {
+                        dl_execute(surface, &dl->cmds[w * 64 + __builtin_ctzll(bits)]);
+                    }
+                }
+                dl->tiles_drawn++;
+
+                if (!run.width) {
+                    run.x = tile.x;
+                }
+                run.width = tile.x + tile.width - run.x;
+            }
+
+            if (run.width && (!dirty || tx == tiles_x - 1)) {
+                dl_add_damage(dl, &run);
+                run.width = 0;
+            }
+        }
+    }
+
+    surface_set_clip(surface, NULL);
+    dl->valid = true;
+    prof_stop(PROF_RASTER, raster_start);
+
+    for (uint32_t i = 0; i < dl->ndamage; i++) {
+        surface_update_rect(surface, dl->damage[i].x, dl->damage[i].y, dl->damage[i].width, dl->damage[i].height);
+    }
+}
@@ -0,0 +1,109 @@
+#pragma once
+
+#include "graphic.h"
+#include "sprite.h"
+
+/**
+ * Retained display list.
+ *
+ * Drawing commands are recorded between dl_begin() and dl_end() instead of
+ * being executed right away. dl_end() bins the commands into DL_TILE_SIZE
+ * square tiles and rasterizes the frame tile by tile through the surface
+ * clip rect, so the pixels a tile works on stay in cache.
+ *
+ * Each tile also gets a hash of the commands that touch it. Tiles whose
+ * hash did not change since the previous frame are neither redrawn nor
+ * presented, the rest are merged into rects for surface_update_rect().
+ * Rect batches are binned and hashed per rect, so a batch spanning the
+ * whole screen only dirties the tiles whose rects changed.
+ *
+ * Commands keep pointers to textures and strings, they must stay valid
+ * until dl_end(). Textures are hashed by address, so their contents
+ * must not change between frames.
+ */
+
+#define DL_TILE_SIZE  64
+#define DL_TILES_X    ((MAX_WINDOW_WIDTH + DL_TILE_SIZE - 1) / DL_TILE_SIZE)
+#define DL_TILES_Y    ((MAX_WINDOW_HEIGHT + DL_TILE_SIZE - 1) / DL_TILE_SIZE)
+#define DL_MAX_CMDS   256
+#define DL_MAX_DAMAGE 8
+
+enum dl_op {
+    DL_FILL,
+    DL_TEXTURE,
+    DL_TEXT,
+    DL_CIRCLE,
+    DL_SPRITES,
+    DL_RECTS,
+};
+
+struct dl_cmd {
+    enum dl_op op;
+    uint32_t color;
+    rect_t rect; /* bounding box, in surface coordinates */
+
+    union {
+        struct {
+            uint32_t *texture;
+            int y_mirror;
+        } texture;
+        struct {
+            struct font_t *font;
+            const char *str;
+            uint32_t len;
+        } text;
+        struct {
+            uint32_t r;
+        } circle;
+        struct {
+            const struct sprite_atlas *atlas;
+            const struct sprite_draw *draws;
+            uint32_t n;
+        } sprites;
+        struct {
+            const rect_t *rects;
+            const uint32_t *colors;
+            uint32_t n;
+        } rects;
+    };
+};
+
+struct display_list {
+    struct surface_t *surface;
+    uint32_t resource_id;
+    uint32_t clear_color;
+
+    uint32_t ncmds;
+    struct dl_cmd cmds[DL_MAX_CMDS];
+    uint64_t cmd_hash[DL_MAX_CMDS];
+
+    /* bit i of a tile bin is set if cmds[i] overlaps the tile */
+    uint64_t bins[DL_TILES_Y][DL_TILES_X][DL_MAX_CMDS / 64];
+    uint64_t tile_hash[DL_TILES_Y][DL_TILES_X];
+    /* sum of hashes of the DL_RECTS rects overlapping the tile */
+    uint64_t rects_hash[DL_TILES_Y][DL_TILES_X];
+    bool valid; /* tile_hash matches the surface contents */
+
+    /* stats of the last dl_end() */
+    uint32_t tiles_drawn;
+    uint32_t ndamage;
+    rect_t damage[DL_MAX_DAMAGE];
+};
+
+void dl_begin(struct display_list *dl, struct surface_t *surface, uint32_t clear_color);
+void dl_fill_rect(struct display_list *dl, const rect_t *rect, uint32_t color);
+void dl_fill_texture(struct display_list *dl, const rect_t *rect, uint32_t *texture, int y_mirror, uint32_t extra_color);
+void dl_draw_text(struct display_list *dl, struct font_t *font, const char *str, uint32_t x, uint32_t y, uint32_t color);
+void dl_draw_circle(struct display_list *dl, uint32_t x, uint32_t y, uint32_t r, uint32_t color);
+
+/* Whole sprite batch as one command, draws are sorted in place */
+void dl_draw_sprites(struct display_list *dl, const struct sprite_atlas *atlas, struct sprite_draw *draws, size_t n);
+
+/* Batch of solid rects as one command, rects may stick out of the surface */
+void dl_fill_rects(struct display_list *dl, const rect_t *rects, const uint32_t *colors, size_t n);
+
+/* Rasterize changed tiles and present them */
+void dl_end(struct display_list *dl);
+
+/* Forget retained contents, next dl_end() redraws the whole surface */
+void dl_invalidate(struct display_list *dl);
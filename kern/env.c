@@ -15,6 +15,7 @@
 #include <kern/kdebug.h>
 #include <kern/macro.h>
 #include <kern/pmap.h>
+#include <kern/trace.h>
 #include <kern/traceopt.h>
 
 /* Currently active environment */
@@ -177,6 +178,7 @@ env_alloc(struct Env **newenv_store, envid_t parent_id, enum EnvType type) {
     *newenv_store = env;
 
     if (trace_envs) cprintf("[%08x] new env %08x\n", curenv ? curenv->env_id : 0, env->env_id);
+    TRACE(ENV_ALLOC, env->env_id, parent_id);
     return 0;
 }
 
@@ -374,6 +376,7 @@ env_free(struct Env *env) {
 
     /* Note the environment's demise. */
     if (trace_envs) cprintf("[%08x] free env %08x\n", curenv ? curenv->env_id : 0, env->env_id);
+    TRACE(ENV_FREE, env->env_id, 0);
 
     /* Return the environment to the free list */
     env->env_status = ENV_FREE;
@@ -487,6 +490,7 @@ env_run(struct Env *env) {
     curenv->env_status = ENV_RUNNING;
     curenv->env_runs++;
 
+    TRACE(ENV_RUN, env->env_id, env->env_tf.tf_rip);
     env_pop_tf(&env->env_tf);
 
     panic("Reached unrecheble\n");    
@@ -0,0 +1,177 @@
+/* Formatting benchmark: snprintf() with format strings the kernel uses a lot,
+ * collected by ./grade-bench fmtbench */
+
+#include <inc/stdio.h>
+#include <inc/stdarg.h>
+#include <inc/string.h>
+#include <inc/error.h>
+
+#include "bench.h"
+
+#define FMTBENCH_TAG "fmtbench"
+
+static char fmt_out[256];
+
+static void
+op_int(void *arg, uint32_t iteration) {
+    snprintf(fmt_out, sizeof(fmt_out), "%d", (int)iteration * 7919);
+}
+
+static void
+op_long(void *arg, uint32_t iteration) {
+    snprintf(fmt_out, sizeof(fmt_out), "%ld", -1234567890123L - iteration);
+}
+
+static void
+op_hex(void *arg, uint32_t iteration) {
+    snprintf(fmt_out, sizeof(fmt_out), "%08lx", 0xDEADBEEFUL + iteration);
+}
+
+static void
+op_ptr(void *arg, uint32_t iteration) {
+    snprintf(fmt_out, sizeof(fmt_out), "%p", (void *)(0x8040000000UL + iteration * 4096));
+}
+
+static void
+op_str(void *arg, uint32_t iteration) {
+    snprintf(fmt_out, sizeof(fmt_out), "%s", "The quick brown fox jumps over the lazy dog");
+}
+
+static void
+op_str_pad(void *arg, uint32_t iteration) {
+    snprintf(fmt_out, sizeof(fmt_out), "%20s", "padded");
+}
+
+static void
+op_env(void *arg, uint32_t iteration) {
+    snprintf(fmt_out, sizeof(fmt_out), "[%08x] new env %08x\n", 0x1000 + iteration, 0x1001 + iteration);
+}
+
+static void
+op_trap(void *arg, uint32_t iteration) {
+    snprintf(fmt_out, sizeof(fmt_out), "Incoming TRAP[%ld] frame at %p\n", 32L + iteration % 16, (void *)fmt_out);
+}
+
+static void
+op_report(void *arg, uint32_t iteration) {
+    snprintf(fmt_out, sizeof(fmt_out), "%s: op=%s iters=%u px=%lu median_cyc=%lu p99_cyc=%lu median_ns=%lu",
+             FMTBENCH_TAG, "report", iteration, 0UL, 1234UL + iteration, 5678UL, 910UL);
+}
+
+/* Known answers
+ *
+ * No format attribute here, so the JOS specific formats and quirks
+ * below (%i, %#s, '-' padding numbers with dashes) don't trip -Wformat. */
+
+static uint32_t fmt_checks, fmt_failed;
+
+static void
+fmt_check(const char *expect, const char *fmt, ...) {
+    char out[64];
+    va_list ap;
+
+    va_start(ap, fmt);
+    int len = vsnprintf(out, sizeof(out), fmt, ap);
+    va_end(ap);
+
+    fmt_checks++;
+    if (strcmp(out, expect) || len != (int)strlen(expect)) {
+        cprintf("%s: check fmt=\"%s\" got=\"%s\" len=%d want=\"%s\"\n", FMTBENCH_TAG, fmt, out, len, expect);
+        fmt_failed++;
+    }
+}
+
+/* Returns 0 if all checks passed */
+static int
+fmt_check_all(void) {
+    fmt_checks = fmt_failed = 0;
+
+    /* conversions and length modifiers */
+    fmt_check("0", "%d", 0);
+    fmt_check("-2147483648", "%d", -2147483647 - 1);
+    fmt_check("-9223372036854775808", "%ld", -9223372036854775807L - 1);
+    fmt_check("123456789012345", "%lld", 123456789012345LL);
+    fmt_check("4294967295", "%u", 4294967295U);
+    fmt_check("18446744073709551615", "%lu", 18446744073709551615UL);
+    fmt_check("42", "%zu", (size_t)42);
+    fmt_check("10", "%o", 8);
+    fmt_check("deadbeef DEADBEEF", "%x %X", 0xDEADBEEF, 0xDEADBEEF);
+    fmt_check("123456789ab", "%lx", 0x123456789ABUL);
+    fmt_check("0x8040000000 0x0", "%p %p", (void *)0x8040000000UL, NULL);
+    fmt_check("ok%", "%c%c%%", 'o', 'k');
+
+    /* flags, width and precision */
+    fmt_check("   42", "%5d", 42);
+    fmt_check("00042", "%05d", 42);
+    fmt_check("-00042", "%05d", -42);
+    fmt_check("12345", "%2d", 12345);
+    fmt_check("0000beef", "%08lx", 0xBEEFUL);
+    fmt_check("     7", "%*d", 6, 7);
+    fmt_check("    ab|ab    |", "%6s|%-6s|", "ab", "ab");
+    fmt_check("abc", "%.3s", "abcdef");
+
+    /* quirks */
+    fmt_check("---42|", "%-5d|", 42);     /* '-' pads numbers with dashes */
+    fmt_check("42", "%.5d", 42);          /* precision is ignored for numbers */
+    fmt_check("x|", "%3c|", 'x');         /* and width for characters */
+    fmt_check("(null)", "%s", NULL);
+    fmt_check("a?b", "%#s", "a\tb");      /* '#' hides unprintable characters */
+    fmt_check("invalid parameter", "%i", -E_INVAL);
+    fmt_check("invalid parameter", "%i", E_INVAL);
+    fmt_check("error 1000", "%i", 1000);
+    fmt_check("a%5yb", "a%5yb");          /* unknown escapes are printed as is */
+
+    /* output past the buffer is counted, but dropped */
+    char small[8];
+    fmt_checks++;
+    if (snprintf(small, sizeof(small), "%s", "truncated!") != 10 || strcmp(small, "truncat")) {
+        cprintf("%s: check truncation got=\"%s\"\n", FMTBENCH_TAG, small);
+        fmt_failed++;
+    }
+
+    cprintf("%s: checks=%u failed=%u\n", FMTBENCH_TAG, fmt_checks, fmt_failed);
+    return fmt_failed ? -E_UNSPECIFIED : 0;
+}
+
+static const struct {
+    const char *name;
+    bench_fn fn;
+} fmt_ops[] = {
+        {"int", op_int},
+        {"long", op_long},
+        {"hex", op_hex},
+        {"ptr", op_ptr},
+        {"str", op_str},
+        {"str_pad", op_str_pad},
+        {"env", op_env},
+        {"trap", op_trap},
+        {"report", op_report},
+};
+
+#define FMT_NOPS (sizeof(fmt_ops) / sizeof(fmt_ops[0]))
+
+int
+fmtbench(uint32_t iters) {
+    if (!iters || iters > BENCH_MAX_SAMPLES) {
+        return -E_INVAL;
+    }
+
+    cprintf("%s: start iters=%u warmup=%u cpu_freq=%lu\n", FMTBENCH_TAG, iters, BENCH_WARMUP,
+            (unsigned long)bench_cpu_freq());
+
+    /* timing a broken formatter is pointless, and without "done" the grade script fails */
+    int res = fmt_check_all();
+    if (res < 0) {
+        return res;
+    }
+
+    for (size_t i = 0; i < FMT_NOPS; i++) {
+        struct bench_result res;
+
+        bench_run(&res, fmt_ops[i].name, fmt_ops[i].fn, NULL, iters, 0);
+        bench_report(FMTBENCH_TAG, &res);
+    }
+
+    cprintf("%s: done\n", FMTBENCH_TAG);
+    return 0;
+}
@@ -0,0 +1,288 @@
+/* Text rendering from the packed coverage font (see kern/font.h).
+ *
+ * Glyph rows are expanded into premultiplied pixels of the requested color
+ * and kept in a small set-associative cache, so drawing a cached glyph
+ * is a copy (opaque runs) or a blend (antialiased edges) per row. */
+
+#include <inc/string.h>
+
+#include "graphic.h"
+#include "pixel.h"
+#include "assets.h"
+
+/* Decoded "font" entry of the asset pack */
+#define FONT_DATA_SIZE (sizeof(struct packed_font_header_t) + \
+                        FONT_SYMBOLS_NUM * FONT_MAX_HEIGHT * FONT_MAX_WIDTH * 4 / 8)
+
+#define GLYPH_CACHE_WAYS 4
+#define GLYPH_CACHE_SETS 16
+#define GLYPH_CACHE_SIZE (GLYPH_CACHE_WAYS * GLYPH_CACHE_SETS)
+
+/* Expanded glyph rows are padded to 8 pixels (one 1bpp byte) */
+#define GLYPH_STRIDE(font) ROUNDUP((font)->char_width, 8)
+
+#define GLYPH_CACHE_POOL (GLYPH_CACHE_SIZE * FONT_MAX_WIDTH * FONT_MAX_HEIGHT)
+
+/* Non-transparent part of an expanded glyph row */
+struct glyph_span {
+    uint8_t start;
+    uint8_t end;
+    bool opaque;
+};
+
+struct glyph_cache_entry {
+    const uint8_t *glyph; /* packed source, NULL if entry is free */
+    uint32_t color;
+    uint64_t last_use;
+    struct glyph_span spans[FONT_MAX_HEIGHT];
+    uint32_t *pixels;
+};
+
+static struct glyph_cache_entry glyph_cache[GLYPH_CACHE_SIZE];
+static uint32_t glyph_cache_pool[GLYPH_CACHE_POOL];
+static uint64_t glyph_cache_clock;
+
+/* 1bpp mask pairs to pixel pairs, the first pixel is the most significant bit */
+static const uint64_t mask2_to_pixels[4] = {
+        0x0000000000000000ULL,
+        0xFFFFFFFF00000000ULL,
+        0x00000000FFFFFFFFULL,
+        0xFFFFFFFFFFFFFFFFULL,
+};
+
+void
+load_font(struct font_t *font) {
+    static uint64_t font_data[FONT_DATA_SIZE / sizeof(uint64_t)];
+    static bool is_decoded = false;
+    struct packed_font_header_t *header = (struct packed_font_header_t *)font_data;
+
+    if (!is_decoded) {
+        const struct asset_pack_entry *entry = asset_find("font", 0);
+        if (!entry || asset_read(entry, font_data, sizeof(font_data)) < 0) {
+            panic("Can't load font from asset pack");
+        }
+        is_decoded = true;
+    }
+
+    assert(header->magic == FONT_PACKED_MAGIC_NUM);
+    assert(header->bpp == 1 || header->bpp == 4);
+    assert(header->char_width <= FONT_MAX_WIDTH && header->char_height <= FONT_MAX_HEIGHT);
+
+    font->char_height = header->char_height;
+    font->char_width = header->char_width;
+    font->bpp = header->bpp;
+    font->row_size = header->row_size;
+    font->glyph_size = header->glyph_size;
+
+    font->glyphs = (const uint8_t *)(header + 1);
+}
+
+static const uint8_t *
+font_glyph(const struct font_t *font, char ch) {
+    unsigned index = FONT_INDEX((unsigned char)ch);
+    if (index >= FONT_SYMBOLS_NUM) {
+        index = FONT_INDEX('?');
+    }
+
+    return font->glyphs + index * font->glyph_size;
+}
+
+static void
+expand_row_1bpp(uint32_t *dst, const uint8_t *src, uint32_t row_size, uint32_t color) {
+    uint64_t color2 = color | ((uint64_t)color << 32);
+
+    for (uint32_t i = 0; i < row_size; i++, dst += 8) {
+        uint8_t mask = src[i];
+        *(pixel2_t *)(dst + 0) = color2 & mask2_to_pixels[(mask >> 6) & 3];
+        *(pixel2_t *)(dst + 2) = color2 & mask2_to_pixels[(mask >> 4) & 3];
+        *(pixel2_t *)(dst + 4) = color2 & mask2_to_pixels[(mask >> 2) & 3];
+        *(pixel2_t *)(dst + 6) = color2 & mask2_to_pixels[mask & 3];
+    }
+}
+
+static void
+expand_row_4bpp(uint32_t *dst, const uint8_t *src, uint32_t row_size, const uint32_t *palette) {
+    for (uint32_t i = 0; i < row_size; i++, dst += 2) {
+        *(pixel2_t *)dst = palette[src[i] >> 4] | ((uint64_t)palette[src[i] & 0xF] << 32);
+    }
+}
+
+static void
+glyph_cache_fill(struct glyph_cache_entry *entry, const struct font_t *font, const uint8_t *glyph, uint32_t color) {
+    uint32_t stride = GLYPH_STRIDE(font);
+    uint32_t palette[16];
+
+    if (font->bpp == 4) {
+        for (uint32_t i = 0; i <= FONT_MAX_COVERAGE(4); i++) {
+            palette[i] = pixel_premultiply(color, i * 0xFF / FONT_MAX_COVERAGE(4));
+        }
+    }
+
+    entry->glyph = glyph;
+    entry->color = color;
+
+    for (uint32_t y = 0; y < font->char_height; y++) {
+        uint32_t *row = entry->pixels + y * stride;
+        const uint8_t *src = glyph + y * font->row_size;
+
+        if (font->bpp == 1) {
+            expand_row_1bpp(row, src, font->row_size, color | PIXEL_ALPHA_MASK);
+        } else {
+            expand_row_4bpp(row, src, font->row_size, palette);
+        }
+
+        struct glyph_span *span = &entry->spans[y];
+        uint32_t start = 0, end = font->char_width;
+
+        while (start < end && !PIXEL_A(row[start])) start++;
+        while (end > start && !PIXEL_A(row[end - 1])) end--;
+
+        span->start = start;
+        span->end = end;
+        span->opaque = true;
+        for (uint32_t x = start; x < end; x++) {
+            if (PIXEL_A(row[x]) != 0xFF) {
+                span->opaque = false;
+                break;
+            }
+        }
+    }
+}
+
+static struct glyph_cache_entry *
+glyph_cache_get(const struct font_t *font, char ch, uint32_t color) {
+    const uint8_t *glyph = font_glyph(font, ch);
+    uint32_t set = ((uintptr_t)glyph / font->glyph_size ^ color ^ (color >> 8)) % GLYPH_CACHE_SETS;
+    struct glyph_cache_entry *ways = glyph_cache + set * GLYPH_CACHE_WAYS;
+    struct glyph_cache_entry *victim = ways;
+
+    glyph_cache_clock++;
+
+    for (int i = 0; i < GLYPH_CACHE_WAYS; i++) {
+        if (ways[i].glyph == glyph && ways[i].color == color) {
+            ways[i].last_use = glyph_cache_clock;
+            return &ways[i];
+        }
+        if (ways[i].last_use < victim->last_use) {
+            victim = &ways[i];
+        }
+    }
+
+    if (!victim->pixels) {
+        victim->pixels = glyph_cache_pool + (victim - glyph_cache) * FONT_MAX_WIDTH * FONT_MAX_HEIGHT;
+    }
+
+    glyph_cache_fill(victim, font, glyph, color);
+    victim->last_use = glyph_cache_clock;
+    return victim;
+}
+
+/* Copy columns [from, to) of one row of a cached glyph, dst points to column 0 */
+static void
+glyph_draw_row(uint32_t *dst, const struct glyph_cache_entry *entry, uint32_t stride, uint32_t row,
+               uint32_t from, uint32_t to) {
+    const struct glyph_span *span = &entry->spans[row];
+    uint32_t start = MAX((uint32_t)span->start, from);
+    uint32_t end = MIN((uint32_t)span->end, to);
+    if (start >= end) {
+        return;
+    }
+
+    const uint32_t *src = entry->pixels + row * stride + start;
+    uint32_t n = end - start;
+    dst += start;
+
+    if (span->opaque) {
+        memcpy(dst, src, n * sizeof(*dst));
+        return;
+    }
+
+    for (uint32_t x = 0; x < n; ++x) {
+        uint32_t alpha = PIXEL_A(src[x]);
+        if (alpha == 0xFF) {
+            dst[x] = src[x];
+        } else if (alpha) {
+            dst[x] = pixel_over(dst[x], src[x]);
+        }
+    }
+}
+
+/* Glyphs are drawn row by row across the whole run, so the backbuf is
+ * walked once per text line. Lookups are done in groups that fit in one
+ * cache set, so an entry can't be evicted while its group is drawn. */
+uint32_t
+surface_draw_text_run(struct surface_t *surface, struct font_t *font, const char *str, size_t len,
+                      uint32_t x, uint32_t y, uint32_t color) {
+    struct glyph_cache_entry *entries[GLYPH_CACHE_WAYS];
+    uint32_t stride = GLYPH_STRIDE(font);
+    uint32_t char_width = font->char_width;
+    uint32_t end_x = x + len * char_width;
+
+    rect_t bounds = {x, y, len * char_width, font->char_height};
+    rect_t clip;
+    if (!surface_clip_rect(surface, &bounds, &clip)) {
+        return end_x;
+    }
+
+    /* skip glyphs left of the clip rect */
+    size_t skip = (clip.x - x) / char_width;
+    str += skip;
+    len -= skip;
+    x += skip * char_width;
+
+    while (len && x < clip.x + clip.width) {
+        size_t n = MIN(len, (size_t)GLYPH_CACHE_WAYS);
+
+        for (size_t i = 0; i < n; i++) {
+            entries[i] = glyph_cache_get(font, str[i], color);
+        }
+
+        for (uint32_t row = clip.y - y; row < clip.y - y + clip.height; row++) {
+            uint32_t *dst = surface->backbuf + (y + row) * surface->width;
+            uint32_t pos_x = x;
+
+            for (size_t i = 0; i < n && pos_x < clip.x + clip.width; i++, pos_x += char_width) {
+                uint32_t from = pos_x < clip.x ? clip.x - pos_x : 0;
+                uint32_t to = MIN(char_width, clip.x + clip.width - pos_x);
+                glyph_draw_row(dst + pos_x, entries[i], stride, row, from, to);
+            }
+        }
+
+        x += n * char_width;
+        str += n;
+        len -= n;
+    }
+
+    return end_x;
+}
+
+uint32_t
+surface_draw_text_scaled(struct surface_t *surface, struct font_t *font, const char *str, uint32_t x, uint32_t y,
+                         uint32_t char_width, uint32_t char_height, uint32_t color) {
+    int flags = BLIT_BLEND;
+
+    /* Nearest is exact for integer upscales, filter everything else */
+    if (char_width % font->char_width || char_height % font->char_height) {
+        flags |= BLIT_BILINEAR;
+    }
+
+    for (; *str; str++, x += char_width) {
+        struct glyph_cache_entry *entry = glyph_cache_get(font, *str, color);
+        rect_t rect = {x, y, char_width, char_height};
+
+        surface_blit_scaled(surface, &rect, entry->pixels, font->char_width, font->char_height,
+                            GLYPH_STRIDE(font), flags);
+    }
+
+    return x;
+}
+
+uint32_t
+surface_draw_text_color(struct surface_t *surface, struct font_t *font, const char *str, uint32_t x, uint32_t y, uint32_t color) {
+    return surface_draw_text_run(surface, font, str, strlen(str), x, y, color);
+}
+
+uint32_t
+surface_draw_text(struct surface_t *surface, struct font_t *font, const char *str, uint32_t x, uint32_t y) {
+    return surface_draw_text_color(surface, font, str, x, y, TEST_XRGB_WHITE);
+}
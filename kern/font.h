@@ -2,15 +2,23 @@
 
 #include <stdint.h>
 
-#define FONT_MAGIC_NUM (0xD34DD3D)
-#define FONT_SYMBOLS_NUM (96)
-#define FONT_INDEX(c) (c - 32) // so we start from printable ' ' and not '\0'
+#define FONT_MAGIC_NUM        (0xD34DD3D)
+#define FONT_PACKED_MAGIC_NUM (0xD34DF0F)
+#define FONT_SYMBOLS_NUM      (96)
+#define FONT_INDEX(c)         (c - 32) // so we start from printable ' ' and not '\0'
+
+/* Coverage is stored as 1 bit (on/off) or 4 bits (16 levels) per pixel */
+#define FONT_MAX_COVERAGE(bpp) ((1U << (bpp)) - 1)
+
+/* Largest glyph the kernel renderer accepts, width is a multiple of 8 */
+#define FONT_MAX_WIDTH  24
+#define FONT_MAX_HEIGHT 40
 
 /**
- * File format
- * 
+ * Raw file format (kern/raw_font.bin, input of kern/fontconv.c)
+ *
  * <font_header_t>
- * right after header: 
+ * right after header:
  * 96 x char_width x char_height xrgb_pixel structs
  */
 
@@ -33,3 +41,23 @@ struct xrgb_pixel {
         uint32_t xrgb_val;
     };
 };
+
+/**
+ * Packed file format (linked into the kernel)
+ *
+ * <packed_font_header_t>
+ * right after header:
+ * 96 glyphs of glyph_size bytes each,
+ * every glyph is char_height rows of row_size bytes,
+ * pixels are packed starting from the most significant bits of a byte
+ */
+
+struct packed_font_header_t {
+    uint64_t magic;         /* should be FONT_PACKED_MAGIC_NUM */
+    uint32_t char_width;
+    uint32_t char_height;
+    uint32_t bpp;           /* 1 or 4 */
+    uint32_t row_size;      /* (char_width * bpp + 7) / 8 */
+    uint32_t glyph_size;    /* row_size * char_height */
+    uint32_t reserved;
+};
@@ -0,0 +1,128 @@
+/* Host tool: converts kern/raw_font.bin (one xrgb_pixel per glyph pixel)
+ * into the packed coverage format that is linked into the kernel.
+ *
+ * Usage: fontconv [-b 1|4] <raw font> <packed font> */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <kern/font.h>
+
+static void
+usage(void) {
+    fprintf(stderr, "Usage: fontconv [-b 1|4] <raw font> <packed font>\n");
+    exit(2);
+}
+
+static void *
+read_file(const char *name, size_t *size) {
+    FILE *file = fopen(name, "rb");
+    if (!file) {
+        perror(name);
+        exit(1);
+    }
+
+    fseek(file, 0, SEEK_END);
+    *size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+
+    void *data = malloc(*size);
+    if (!data || fread(data, 1, *size, file) != *size) {
+        fprintf(stderr, "%s: read failed\n", name);
+        exit(1);
+    }
+
+    fclose(file);
+    return data;
+}
+
+/* Font glyphs are grayscale, so any channel is the pixel coverage */
+static unsigned
+pixel_coverage(const struct xrgb_pixel *pixel, unsigned bpp) {
+    if (!pixel->is_enabled) {
+        return 0;
+    }
+
+    if (bpp == 1) {
+        return pixel->R >= 0x80;
+    }
+
+    return (pixel->R * FONT_MAX_COVERAGE(bpp) + 127) / 255;
+}
+
+int
+main(int argc, char **argv) {
+    unsigned bpp = 4;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "b:")) != -1) {
+        switch (opt) {
+        case 'b':
+            bpp = atoi(optarg);
+            break;
+        default:
+            usage();
+        }
+    }
+
+    if (argc - optind != 2 || (bpp != 1 && bpp != 4)) {
+        usage();
+    }
+
+    size_t size;
+    struct font_header_t *raw = read_file(argv[optind], &size);
+
+    if (size < sizeof(*raw) || raw->magic != FONT_MAGIC_NUM) {
+        fprintf(stderr, "%s: not a raw font\n", argv[optind]);
+        return 1;
+    }
+
+    size_t npixels = (size_t)raw->char_width * raw->char_height;
+    if (size < sizeof(*raw) + FONT_SYMBOLS_NUM * npixels * sizeof(struct xrgb_pixel)) {
+        fprintf(stderr, "%s: truncated font\n", argv[optind]);
+        return 1;
+    }
+
+    struct packed_font_header_t header = {
+            .magic = FONT_PACKED_MAGIC_NUM,
+            .char_width = raw->char_width,
+            .char_height = raw->char_height,
+            .bpp = bpp,
+            .row_size = (raw->char_width * bpp + 7) / 8,
+    };
+    header.glyph_size = header.row_size * header.char_height;
+
+    size_t packed_size = (size_t)FONT_SYMBOLS_NUM * header.glyph_size;
+    uint8_t *packed = calloc(1, packed_size);
+    const struct xrgb_pixel *pixels = (const struct xrgb_pixel *)(raw + 1);
+
+    for (size_t glyph = 0; glyph < FONT_SYMBOLS_NUM; glyph++) {
+        for (size_t y = 0; y < header.char_height; y++) {
+            uint8_t *row = packed + glyph * header.glyph_size + y * header.row_size;
+
+            for (size_t x = 0; x < header.char_width; x++) {
+                const struct xrgb_pixel *pixel = pixels + glyph * npixels + y * header.char_width + x;
+                size_t bit = x * bpp;
+
+                row[bit / 8] |= pixel_coverage(pixel, bpp) << (8 - bpp - bit % 8);
+            }
+        }
+    }
+
+    FILE *out = fopen(argv[optind + 1], "wb");
+    if (!out) {
+        perror(argv[optind + 1]);
+        return 1;
+    }
+
+    if (fwrite(&header, sizeof(header), 1, out) != 1 ||
+        fwrite(packed, 1, packed_size, out) != packed_size) {
+        fprintf(stderr, "%s: write failed\n", argv[optind + 1]);
+        return 1;
+    }
+
+    fclose(out);
+    return 0;
+}
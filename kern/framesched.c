@@ -0,0 +1,95 @@
+/* Fixed timestep frame scheduler, see framesched.h */
+
+#include <inc/assert.h>
+#include <inc/stdio.h>
+#include <inc/x86.h>
+
+#include "framesched.h"
+#include "timer.h"
+
+void
+frame_sched_init(struct frame_sched *sched, uint32_t tick_hz, uint32_t frame_hz, bool free_run) {
+    assert(tick_hz && frame_hz);
+
+    *sched = (struct frame_sched){0};
+    sched->cpu_freq = timer_for_schedule->get_cpu_freq();
+    sched->tick_cycles = sched->cpu_freq / tick_hz;
+    sched->frame_cycles = sched->cpu_freq / frame_hz;
+    sched->free_run = free_run;
+
+    sched->start = sched->last = read_tsc();
+    sched->deadline = sched->start + sched->frame_cycles;
+}
+
+uint32_t
+frame_sched_ticks(struct frame_sched *sched) {
+    uint32_t ticks;
+
+    if (sched->free_run) {
+        /* simulated time advances by exactly one frame */
+        sched->lag += sched->frame_cycles;
+    } else {
+        uint64_t now = read_tsc();
+        sched->lag += now - sched->last;
+        sched->last = now;
+    }
+
+    ticks = sched->lag / sched->tick_cycles;
+    sched->lag -= (uint64_t)ticks * sched->tick_cycles;
+
+    /* don't try to catch up after a long stall */
+    if (ticks > FRAME_SCHED_MAX_TICKS) {
+        ticks = FRAME_SCHED_MAX_TICKS;
+        sched->lag = 0;
+    }
+
+    sched->ticks += ticks;
+    return ticks;
+}
+
+uint32_t
+frame_sched_alpha(const struct frame_sched *sched) {
+    /* draw exactly what was simulated */
+    if (sched->free_run) {
+        return FRAME_ALPHA_ONE;
+    }
+    return sched->lag * FRAME_ALPHA_ONE / sched->tick_cycles;
+}
+
+void
+frame_sched_wait(struct frame_sched *sched) {
+    sched->frames++;
+
+    if (sched->free_run) {
+        return;
+    }
+
+    uint64_t now = read_tsc();
+
+    if (now > sched->deadline) {
+        uint64_t late = now - sched->deadline;
+
+        sched->missed++;
+        sched->max_late = MAX(sched->max_late, late);
+
+        /* skip the periods we are already late for */
+        sched->deadline += (late / sched->frame_cycles + 1) * sched->frame_cycles;
+        return;
+    }
+
+    while (read_tsc() < sched->deadline) {
+        asm volatile("pause");
+    }
+    sched->deadline += sched->frame_cycles;
+}
+
+void
+frame_sched_report(const struct frame_sched *sched, const char *tag) {
+    uint64_t cycles_us = MAX(sched->cpu_freq / 1000000, 1);
+    uint64_t elapsed = read_tsc() - sched->start;
+
+    cprintf("%s: frames=%u ticks=%u missed=%u max_late_us=%lu avg_frame_us=%lu\n",
+            tag, sched->frames, sched->ticks, sched->missed,
+            (unsigned long)(sched->max_late / cycles_us),
+            (unsigned long)(sched->frames ? elapsed / sched->frames / cycles_us : 0));
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <inc/types.h>
+
+/**
+ * Frame scheduler for game loops.
+ *
+ * Simulation runs in fixed ticks of 1/tick_hz seconds, independent of
+ * how long a frame took to render. Every frame frame_sched_ticks() says
+ * how many ticks to run to catch up with the clock, and the leftover
+ * time is returned by frame_sched_alpha() so rendering can interpolate
+ * between the previous and the current simulation state.
+ *
+ * Frames are paced with absolute TSC deadlines spaced 1/frame_hz apart,
+ * so the time spent rendering doesn't add up to the frame period. A frame
+ * that finishes after its deadline is counted as missed and the next
+ * deadline is moved forward by whole periods to keep the phase.
+ *
+ * In free run mode (headless) nothing waits and every frame runs exactly
+ * tick_hz / frame_hz ticks, so runs are reproducible.
+ */
+
+#define FRAME_SCHED_MAX_TICKS 5 /* per frame, drop time beyond that */
+#define FRAME_ALPHA_ONE       256
+
+struct frame_sched {
+    uint64_t cpu_freq;
+    uint64_t tick_cycles;
+    uint64_t frame_cycles;
+    bool free_run;
+
+    uint64_t last;     /* TSC at the previous frame_sched_ticks() */
+    uint64_t lag;      /* cycles not simulated yet */
+    uint64_t deadline; /* absolute TSC of the end of this frame */
+
+    /* stats */
+    uint64_t start;
+    uint32_t frames;
+    uint32_t ticks;
+    uint32_t missed;
+    uint64_t max_late; /* in cycles */
+};
+
+void frame_sched_init(struct frame_sched *sched, uint32_t tick_hz, uint32_t frame_hz, bool free_run);
+
+/* Start of a frame, returns number of simulation ticks to run */
+uint32_t frame_sched_ticks(struct frame_sched *sched);
+/* Position between previous and current tick, 0..FRAME_ALPHA_ONE */
+uint32_t frame_sched_alpha(const struct frame_sched *sched);
+
+/* End of a frame, waits for its deadline */
+void frame_sched_wait(struct frame_sched *sched);
+
+/* "<tag>: frames=... ticks=... missed=... max_late_us=... avg_frame_us=...",
+ * grade-headless matches the pong line, add new fields at the end only */
+void frame_sched_report(const struct frame_sched *sched, const char *tag);
@@ -0,0 +1,189 @@
+/* Graphics benchmark suite: graphic.c primitives and the present path */
+
+#include <inc/assert.h>
+#include <inc/stdio.h>
+#include <inc/string.h>
+#include <inc/error.h>
+
+#include "bench.h"
+#include "graphic.h"
+#include "sprite.h"
+#include "text.h"
+
+#define GFXBENCH_TAG "gfxbench"
+
+static const char gfxbench_text[] = "The quick brown fox jumps over the lazy dog 0123456789";
+
+struct gfx_op;
+typedef uint64_t (*gfx_pixels_fn)(const struct gfx_op *op);
+
+struct gfx_op {
+    const char *name;
+    bench_fn fn;
+    gfx_pixels_fn pixels;
+    uint32_t size;
+};
+
+static struct {
+    struct surface_t *surface;
+    struct font_t *font;
+    const uint32_t *texture;
+    uint32_t tex_w, tex_h;
+} ctx;
+
+/* Moves op around the screen, so it doesn't hit the same cache lines every time */
+static rect_t
+place_rect(uint32_t width, uint32_t height, uint32_t iteration) {
+    uint32_t w = MIN(width, ctx.surface->width);
+    uint32_t h = MIN(height, ctx.surface->height);
+
+    return (rect_t){(iteration * 37) % (ctx.surface->width - w + 1),
+                    (iteration * 53) % (ctx.surface->height - h + 1), w, h};
+}
+
+static rect_t
+op_rect(const struct gfx_op *op, uint32_t iteration) {
+    return place_rect(op->size, op->size, iteration);
+}
+
+static void
+op_clear(void *arg, uint32_t iteration) {
+    surface_clear(ctx.surface, iteration & 1 ? TEST_XRGB_BLACK : TEST_XRGB_BLUE);
+}
+
+static void
+op_fill_rect(void *arg, uint32_t iteration) {
+    rect_t rect = op_rect(arg, iteration);
+    surface_fill_rect(ctx.surface, &rect, TEST_XRGB_GREY);
+}
+
+static void
+op_fill_rect_alpha(void *arg, uint32_t iteration) {
+    rect_t rect = op_rect(arg, iteration);
+    surface_fill_rect_alpha(ctx.surface, &rect, TEST_XRGB_RED, 0x80);
+}
+
+static void
+op_circle(void *arg, uint32_t iteration) {
+    const struct gfx_op *op = arg;
+    rect_t rect = op_rect(op, iteration);
+    uint32_t r = op->size / 2;
+
+    surface_draw_circle(ctx.surface, rect.x + r, rect.y + r, r, TEST_XRGB_WHITE);
+}
+
+static void
+op_blit(void *arg, uint32_t iteration) {
+    rect_t rect = place_rect(ctx.tex_w, ctx.tex_h, iteration);
+    surface_fill_texture(ctx.surface, &rect, (uint32_t *)ctx.texture, 0, 0);
+}
+
+static void
+op_blit_scaled(void *arg, uint32_t iteration) {
+    rect_t rect = op_rect(arg, iteration);
+    surface_blit_scaled(ctx.surface, &rect, ctx.texture, ctx.tex_w, ctx.tex_h,
+                        ctx.tex_w, BLIT_BILINEAR);
+}
+
+static void
+op_text(void *arg, uint32_t iteration) {
+    uint32_t y = (iteration * 53) % (ctx.surface->height - ctx.font->char_height + 1);
+    surface_draw_text_run(ctx.surface, ctx.font, gfxbench_text, sizeof(gfxbench_text) - 1,
+                          0, y, TEST_XRGB_WHITE);
+}
+
+static void
+op_present(void *arg, uint32_t iteration) {
+    surface_display(ctx.surface);
+}
+
+static void
+op_present_rect(void *arg, uint32_t iteration) {
+    rect_t rect = op_rect(arg, iteration);
+    surface_update_rect(ctx.surface, rect.x, rect.y, rect.width, rect.height);
+}
+
+static uint64_t
+pixels_square(const struct gfx_op *op) {
+    return (uint64_t)op->size * op->size;
+}
+
+static uint64_t
+pixels_circle(const struct gfx_op *op) {
+    uint64_t r = op->size / 2;
+    return r * r * 355 / 113;
+}
+
+static uint64_t
+pixels_texture(const struct gfx_op *op) {
+    return (uint64_t)ctx.tex_w * ctx.tex_h;
+}
+
+static uint64_t
+pixels_screen(const struct gfx_op *op) {
+    return (uint64_t)ctx.surface->width * ctx.surface->height;
+}
+
+static uint64_t
+pixels_text(const struct gfx_op *op) {
+    struct text_extent extent = text_measure(ctx.font, gfxbench_text);
+    return (uint64_t)MIN(extent.width, ctx.surface->width) * extent.height;
+}
+
+static struct gfx_op gfx_ops[] = {
+        {"clear", op_clear, pixels_screen, 0},
+        {"fill_rect_8", op_fill_rect, pixels_square, 8},
+        {"fill_rect_64", op_fill_rect, pixels_square, 64},
+        {"fill_rect_256", op_fill_rect, pixels_square, 256},
+        {"fill_rect_alpha_64", op_fill_rect_alpha, pixels_square, 64},
+        {"circle_32", op_circle, pixels_circle, 32},
+        {"circle_256", op_circle, pixels_circle, 256},
+        {"blit", op_blit, pixels_texture, 0},
+        {"blit_scaled_128", op_blit_scaled, pixels_square, 128},
+        {"text", op_text, pixels_text, 0},
+        {"present_64", op_present_rect, pixels_square, 64},
+        {"present", op_present, pixels_screen, 0},
+};
+
+#define GFX_NOPS (sizeof(gfx_ops) / sizeof(gfx_ops[0]))
+
+int
+gfxbench(uint32_t iters, const char *filter) {
+    if (!iters || iters > BENCH_MAX_SAMPLES) {
+        return -E_INVAL;
+    }
+
+    struct sprite_atlas *atlas = get_main_atlas();
+    const struct sprite *sprite = &atlas->sprites[0];
+
+    ctx.surface = get_main_surface();
+    ctx.font = get_main_font();
+    /* rows of the frame are sprite->width pixels apart */
+    ctx.tex_w = sprite->width;
+    ctx.tex_h = sprite->height;
+    ctx.texture = asset_frame(sprite->entry);
+
+    cprintf("%s: start iters=%u warmup=%u cpu_freq=%lu screen=%ux%u headless=%d\n", GFXBENCH_TAG, iters, BENCH_WARMUP,
+            (unsigned long)bench_cpu_freq(), ctx.surface->width, ctx.surface->height, surface_is_offscreen(ctx.surface));
+
+    for (size_t i = 0; i < GFX_NOPS; i++) {
+        struct gfx_op *op = &gfx_ops[i];
+        struct bench_result res;
+
+        if (filter && strncmp(op->name, filter, strlen(filter))) {
+            continue;
+        }
+
+        surface_clear(ctx.surface, TEST_XRGB_BLACK);
+        bench_run(&res, op->name, op->fn, op, iters, op->pixels(op));
+        bench_report(GFXBENCH_TAG, &res);
+
+        /* iterations are deterministic, so is what they leave on the surface */
+        if (surface_is_offscreen(ctx.surface)) {
+            cprintf("%s: checksum op=%s crc32c=%08x\n", GFXBENCH_TAG, op->name, surface_checksum(ctx.surface));
+        }
+    }
+
+    cprintf("%s: done\n", GFXBENCH_TAG);
+    return 0;
+}
@@ -0,0 +1,174 @@
+/* Text console on a virtio-gpu surface, see gpucons.h */
+
+#include <inc/string.h>
+
+#include "gpucons.h"
+#include "graphic.h"
+
+#define GPUCONS_FG   TEST_XRGB_WHITE
+#define GPUCONS_BG   TEST_XRGB_BLACK
+#define GPUCONS_TABW 5 /* same as the framebuffer console */
+
+static struct {
+    bool enabled;
+    /* set while drawing, cprintf() from the present path only fills cells */
+    bool flushing;
+    bool dirty;
+
+    struct surface_t surface;
+    struct font_t *font;
+    uint32_t cols;
+    uint32_t rows;
+
+    uint32_t top; /* ring line shown on screen row 0 */
+    uint32_t row; /* cursor, in screen rows */
+    uint32_t col;
+    uint32_t lines; /* new lines since the last flush */
+
+    char cells[GPUCONS_MAX_ROWS][GPUCONS_MAX_COLS];
+    /* what the surface shows, by screen row */
+    char shown[GPUCONS_MAX_ROWS][GPUCONS_MAX_COLS];
+} gcons;
+
+static char *
+gpucons_line(uint32_t row) {
+    return gcons.cells[(gcons.top + row) % gcons.rows];
+}
+
+static void
+gpucons_setup(void) {
+    gcons.font = get_main_font();
+    surface_init(&gcons.surface, MAX_WINDOW_WIDTH, MAX_WINDOW_HEIGHT);
+    surface_clear(&gcons.surface, GPUCONS_BG);
+
+    gcons.cols = MIN(gcons.surface.width / gcons.font->char_width, GPUCONS_MAX_COLS);
+    gcons.rows = MIN(gcons.surface.height / gcons.font->char_height, GPUCONS_MAX_ROWS);
+    memset(gcons.cells, ' ', sizeof(gcons.cells));
+    memset(gcons.shown, ' ', sizeof(gcons.shown));
+}
+
+void
+gpucons_enable(bool enable) {
+    if (enable && !gcons.font) {
+        gpucons_setup();
+    }
+    gcons.enabled = enable;
+
+    if (enable) {
+        /* take the scanout back */
+        gcons.flushing = true;
+        surface_display(&gcons.surface);
+        gcons.flushing = false;
+    }
+}
+
+bool
+gpucons_enabled(void) {
+    return gcons.enabled;
+}
+
+static void
+gpucons_newline(void) {
+    gcons.col = 0;
+    if (gcons.row + 1 < gcons.rows) {
+        gcons.row++;
+    } else {
+        /* scroll, the top line comes back as the bottom one */
+        gcons.top = (gcons.top + 1) % gcons.rows;
+        memset(gpucons_line(gcons.row), ' ', gcons.cols);
+    }
+
+    if (++gcons.lines >= GPUCONS_BATCH_LINES) {
+        gpucons_flush();
+    }
+}
+
+void
+gpucons_putc(int c) {
+    if (!gcons.enabled) return;
+
+    c &= 0xFF;
+    gcons.dirty = true;
+
+    switch (c) {
+    case '\b':
+        if (gcons.col > 0) {
+            gpucons_line(gcons.row)[--gcons.col] = ' ';
+        }
+        break;
+    case '\n':
+        gpucons_newline();
+        break;
+    case '\r':
+        gcons.col = 0;
+        break;
+    case '\t':
+        for (size_t i = 0; i < GPUCONS_TABW; i++)
+            gpucons_putc(' ');
+        break;
+    default:
+        if (c < ' ' || c > '~') break;
+        if (gcons.col == gcons.cols) {
+            gpucons_newline();
+        }
+        gpucons_line(gcons.row)[gcons.col++] = c;
+    }
+}
+
+/* Redraws cells [*from, *to) of the screen row that differ from the
+ * surface, returns false if there are none */
+static bool
+gpucons_redraw_row(uint32_t row, uint32_t *from, uint32_t *to) {
+    const char *line = gpucons_line(row);
+    char *shown = gcons.shown[row];
+    uint32_t first = 0, last = gcons.cols;
+
+    while (first < last && line[first] == shown[first]) first++;
+    if (first == last) return false;
+    while (line[last - 1] == shown[last - 1]) last--;
+
+    struct font_t *font = gcons.font;
+    rect_t rect = {first * font->char_width, row * font->char_height,
+                   (last - first) * font->char_width, font->char_height};
+
+    surface_fill_rect(&gcons.surface, &rect, GPUCONS_BG);
+    surface_draw_text_run(&gcons.surface, font, line + first, last - first, rect.x, rect.y, GPUCONS_FG);
+    memcpy(shown + first, line + first, last - first);
+
+    *from = first;
+    *to = last;
+    return true;
+}
+
+void
+gpucons_flush(void) {
+    if (!gcons.enabled || !gcons.dirty || gcons.flushing) return;
+    gcons.flushing = true;
+    gcons.dirty = false;
+    gcons.lines = 0;
+
+    uint32_t char_w = gcons.font->char_width;
+    uint32_t char_h = gcons.font->char_height;
+    /* damaged run of rows [damage_row, row) and its columns */
+    uint32_t damage_row = gcons.rows, damage_from = 0, damage_to = 0;
+
+    for (uint32_t row = 0; row <= gcons.rows; row++) {
+        uint32_t from, to;
+
+        if (row < gcons.rows && gpucons_redraw_row(row, &from, &to)) {
+            if (damage_row == gcons.rows) {
+                damage_row = row;
+                damage_from = from;
+                damage_to = to;
+            }
+            damage_from = MIN(damage_from, from);
+            damage_to = MAX(damage_to, to);
+        } else if (damage_row != gcons.rows) {
+            surface_update_rect(&gcons.surface, damage_from * char_w, damage_row * char_h,
+                                (damage_to - damage_from) * char_w, (row - damage_row) * char_h);
+            damage_row = gcons.rows;
+        }
+    }
+
+    gcons.flushing = false;
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <inc/types.h>
+
+/**
+ * Text console on a virtio-gpu surface.
+ *
+ * Characters go into a grid of cells, one byte per cell. The grid is a
+ * ring of lines: scrolling moves the top line index and clears the line
+ * that comes in at the bottom, nothing is copied.
+ *
+ * gpucons_flush() compares every screen row with what is drawn on the
+ * surface, redraws the changed span of cells of that row with the glyph
+ * cache and presents the damaged rows, consecutive rows in one rect.
+ * The console is flushed every GPUCONS_BATCH_LINES lines and when input
+ * is polled, so a burst of cprintf()s costs one redraw, not one per line.
+ */
+
+#define GPUCONS_MAX_COLS    80
+#define GPUCONS_MAX_ROWS    60
+#define GPUCONS_BATCH_LINES 8
+
+/* The surface is created on first use, offscreen in headless mode */
+void gpucons_enable(bool enable);
+bool gpucons_enabled(void);
+
+void gpucons_putc(int c);
+void gpucons_flush(void);
@@ -1,21 +1,30 @@
 #include "graphic.h"
+#include "pixel.h"
 #include <inc/x86.h>
 #include <inc/stdio.h>
 #include "timer.h"
-
-extern char __bin_start[];
-extern char __bin_end[];
+#include "crc32c.h"
 
 static uint64_t cpu_freq_ms = 0;
 
+enum pixel_format surface_host_format = PIXFMT_NATIVE;
+
+#ifdef CONFIG_HEADLESS
+bool gfx_headless = true;
+#else
+bool gfx_headless = false;
+#endif
+
 struct surface_t *
 get_main_surface() {
     static struct surface_t main_surface = {};
     static bool is_init = false;
 
-    if (!is_init) {
+    /* Every surface_init() creates a host resource, so only redo it when
+     * the headless mode no longer matches the surface */
+    if (!is_init || surface_is_offscreen(&main_surface) != (gfx_headless || !gpu.screen_w)) {
         surface_init(&main_surface, gpu.screen_w, gpu.screen_h);
-        // is_init = true; // WTF? why is not working
+        is_init = true;
     }
 
     return &main_surface;
@@ -33,83 +42,455 @@ get_main_font() {
     return &font;
 }
 void
-surface_draw_circle(struct surface_t *resource, uint64_t x_center, uint64_t y_center, uint64_t r, uint32_t color) {
-    for (uint64_t y = y_center - r; y <= y_center + r; y++) {
-        for (uint64_t x = x_center - r; x <= x_center + r; x++) {
-            if ((x - x_center) * (x - x_center) + (y - y_center) * (y - y_center) <= r * r) {
-                resource->backbuf[y * resource->width + x] = color;
-            }
+surface_set_clip(struct surface_t *surface, const rect_t *clip) {
+    rect_t whole = {0, 0, surface->width, surface->height};
+
+    surface->clip = whole;
+    if (clip && !surface_clip_rect(surface, clip, &surface->clip)) {
+        surface->clip.width = surface->clip.height = 0;
+    }
+}
+
+/* Intersect rect with the surface clip rect, returns false if nothing is left.
+ * Rect coordinates are treated as signed, so objects partially moved off
+ * the screen are clipped instead of wrapping around. */
+bool
+surface_clip_rect(const struct surface_t *surface, const rect_t *rect, rect_t *clipped) {
+    int64_t x0 = MAX((int64_t)(int32_t)rect->x, (int64_t)surface->clip.x);
+    int64_t y0 = MAX((int64_t)(int32_t)rect->y, (int64_t)surface->clip.y);
+    int64_t x1 = MIN((int64_t)(int32_t)rect->x + rect->width, (int64_t)surface->clip.x + surface->clip.width);
+    int64_t y1 = MIN((int64_t)(int32_t)rect->y + rect->height, (int64_t)surface->clip.y + surface->clip.height);
+
+    if (x0 >= x1 || y0 >= y1) {
+        return false;
+    }
+
+    clipped->x = x0;
+    clipped->y = y0;
+    clipped->width = x1 - x0;
+    clipped->height = y1 - y0;
+    return true;
+}
+
+void
+surface_fill_span(struct surface_t *surface, int32_t x0, int32_t x1, int32_t y, uint32_t color) {
+    const rect_t *clip = &surface->clip;
+
+    if (y < (int64_t)clip->y || y >= (int64_t)clip->y + clip->height) {
+        return;
+    }
+
+    x0 = MAX((int64_t)x0, (int64_t)clip->x);
+    x1 = MIN((int64_t)x1, (int64_t)clip->x + clip->width);
+    if (x0 >= x1) {
+        return;
+    }
+
+    uint32_t *dst = surface->backbuf + y * surface->width + x0;
+    uint32_t n = x1 - x0;
+
+    /* align to 8 bytes and store two pixels at a time */
+    if ((uintptr_t)dst & 4) {
+        *dst++ = color;
+        n--;
+    }
+
+    uint64_t color2 = color | ((uint64_t)color << 32);
+    for (; n >= 2; n -= 2, dst += 2) {
+        *(uint64_t *)dst = color2;
+    }
+    if (n) {
+        *dst = color;
+    }
+}
+
+static uint32_t
+isqrt(uint64_t x) {
+    uint64_t res = 0;
+    uint64_t bit = 1ULL << 62;
+
+    while (bit > x) bit >>= 2;
+
+    while (bit) {
+        if (x >= res + bit) {
+            x -= res + bit;
+            res = (res >> 1) + bit;
+        } else {
+            res >>= 1;
         }
+        bit >>= 2;
+    }
+    return res;
+}
+
+void
+surface_draw_circle(struct surface_t *resource, uint64_t x_center, uint64_t y_center, uint64_t r, uint32_t color) {
+    int32_t cx = x_center, cy = y_center;
+    int64_t r2 = r * r;
+
+    /* one span per row: all x with (x - cx)^2 + dy^2 <= r^2 */
+    for (int64_t dy = -(int64_t)r; dy <= (int64_t)r; dy++) {
+        int32_t half = isqrt(r2 - dy * dy);
+        surface_fill_span(resource, cx - half, cx + half + 1, cy + dy, color);
     }
 }
 
 // SDL_FillRect
 void
 surface_fill_rect(struct surface_t *surface, const rect_t *rect, uint32_t color) {
-    for (int y = rect->y; y < rect->y + rect->height; ++y) {
-        for (int x = rect->x; x < rect->x + rect->width; ++x) {
-            surface->backbuf[y * surface->width + x] = color;
+    rect_t clip;
+    if (!surface_clip_rect(surface, rect, &clip)) {
+        return;
+    }
+
+    for (uint32_t y = clip.y; y < clip.y + clip.height; ++y) {
+        surface_fill_span(surface, clip.x, clip.x + clip.width, y, color);
+    }
+}
+
+/* Bresenham; pixels of an x-major line that share a row are emitted as one span */
+static void
+draw_thin_line(struct surface_t *surface, point_t p0, point_t p1, uint32_t color) {
+    int32_t dx = p1.x > p0.x ? p1.x - p0.x : p0.x - p1.x;
+    int32_t dy = p1.y > p0.y ? p0.y - p1.y : p1.y - p0.y;
+    int32_t sx = p0.x < p1.x ? 1 : -1;
+    int32_t sy = p0.y < p1.y ? 1 : -1;
+    int32_t err = dx + dy;
+    int32_t span_x = p0.x;
+
+    for (;;) {
+        bool last = p0.x == p1.x && p0.y == p1.y;
+        int32_t e2 = 2 * err;
+        bool step_y = !last && e2 <= dx;
+
+        /* row is about to change (or line ends), flush the run */
+        if (last || step_y) {
+            surface_fill_span(surface, MIN(span_x, p0.x), MAX(span_x, p0.x) + 1, p0.y, color);
+        }
+        if (last) {
+            break;
+        }
+
+        if (e2 >= dy) {
+            err += dy;
+            p0.x += sx;
+        }
+        if (step_y) {
+            err += dx;
+            p0.y += sy;
+            span_x = p0.x;
+        }
+    }
+}
+
+void
+surface_draw_line(struct surface_t *surface, point_t p0, point_t p1, uint32_t width, uint32_t color) {
+    if (width <= 1) {
+        draw_thin_line(surface, p0, p1, color);
+        return;
+    }
+
+    int64_t dx = p1.x - p0.x, dy = p1.y - p0.y;
+    uint32_t len = isqrt(dx * dx + dy * dy);
+    if (!len) {
+        rect_t dot = {p0.x - width / 2, p0.y - width / 2, width, width};
+        surface_fill_rect(surface, &dot, color);
+        return;
+    }
+
+    /* half width offset along the line normal, rounded to nearest */
+    int32_t nx = (-dy * width + (dy < 0 ? (int64_t)len : -(int64_t)len)) / (2 * (int64_t)len);
+    int32_t ny = (dx * width + (dx < 0 ? -(int64_t)len : (int64_t)len)) / (2 * (int64_t)len);
+
+    point_t quad[4] = {
+            {p0.x + nx, p0.y + ny},
+            {p1.x + nx, p1.y + ny},
+            {p1.x - nx, p1.y - ny},
+            {p0.x - nx, p0.y - ny},
+    };
+    surface_fill_convex_polygon(surface, quad, 4, color);
+}
+
+void
+surface_draw_polyline(struct surface_t *surface, const point_t *points, size_t npoints, uint32_t width, uint32_t color) {
+    for (size_t i = 1; i < npoints; i++) {
+        surface_draw_line(surface, points[i - 1], points[i], width, color);
+    }
+}
+
+/* Per row span ends, shared by all polygon fills (single CPU) */
+static int32_t edge_left[MAX_WINDOW_HEIGHT];
+static int32_t edge_right[MAX_WINDOW_HEIGHT];
+
+/* Pixel centers are sampled, so a pixel is filled if (x + 0.5, y + 0.5)
+ * is inside. Edges are walked in 16.16 fixed point and only widen the
+ * span of each row, which is enough for convex polygons. */
+void
+surface_fill_convex_polygon(struct surface_t *surface, const point_t *points, size_t npoints, uint32_t color) {
+    if (npoints < 3) {
+        return;
+    }
+
+    int32_t ymin = points[0].y, ymax = points[0].y;
+    for (size_t i = 1; i < npoints; i++) {
+        ymin = MIN(ymin, points[i].y);
+        ymax = MAX(ymax, points[i].y);
+    }
+
+    ymin = MAX((int64_t)ymin, (int64_t)surface->clip.y);
+    ymax = MIN((int64_t)ymax, (int64_t)surface->clip.y + surface->clip.height);
+    if (ymin >= ymax) {
+        return;
+    }
+
+    for (int32_t y = ymin; y < ymax; y++) {
+        edge_left[y] = INT32_MAX;
+        edge_right[y] = INT32_MIN;
+    }
+
+    for (size_t i = 0; i < npoints; i++) {
+        point_t a = points[i];
+        point_t b = points[(i + 1) % npoints];
+        if (a.y == b.y) {
+            continue;
+        }
+        if (a.y > b.y) {
+            point_t t = a;
+            a = b;
+            b = t;
+        }
+
+        int64_t step = ((int64_t)(b.x - a.x) << 16) / (b.y - a.y);
+        int32_t y0 = MAX(a.y, ymin), y1 = MIN(b.y, ymax);
+        /* x at the center of row y0 */
+        int64_t x = ((int64_t)a.x << 16) + step * (y0 - a.y) + step / 2;
+
+        for (int32_t y = y0; y < y1; y++, x += step) {
+            /* first pixel with center at or right of x: ceil(x - 0.5) */
+            int32_t px = (x - 0x8000 + 0xFFFF) >> 16;
+            edge_left[y] = MIN(edge_left[y], px);
+            edge_right[y] = MAX(edge_right[y], px);
+        }
+    }
+
+    for (int32_t y = ymin; y < ymax; y++) {
+        if (edge_left[y] < edge_right[y]) {
+            surface_fill_span(surface, edge_left[y], edge_right[y], y, color);
         }
     }
 }
 
 void
 surface_fill_texture(struct surface_t *surface, const rect_t *rect, uint32_t *texture, int y_mirror, uint32_t extra_color) {
+    rect_t clip;
+    if (!surface_clip_rect(surface, rect, &clip)) {
+        return;
+    }
+
+    /* texture coordinates of the clipped rect */
+    uint32_t tx = clip.x - rect->x;
+    uint32_t ty = clip.y - rect->y;
+
     if (y_mirror) {
-        for (int y = rect->y; y < rect->y + rect->height; ++y) {
-            for (int x = rect->x; x < rect->x + rect->width; ++x) {
-                surface->backbuf[y * surface->width + x] = texture[(y - rect->y) * rect->width + rect->x + rect->width - x - 1];
+        for (uint32_t y = 0; y < clip.height; ++y) {
+            uint32_t *dst = surface->backbuf + (clip.y + y) * surface->width + clip.x;
+            const uint32_t *src = texture + (ty + y) * rect->width + rect->width - tx - 1;
+            for (uint32_t x = 0; x < clip.width; ++x) {
+                dst[x] = *(src - x);
             }
         }
     } else {
-        for (int y = rect->y; y < rect->y + rect->height; ++y) {
-            for (int x = rect->x; x < rect->x + rect->width; ++x) {
-                size_t idx = y * surface->width + x;
-                surface->backbuf[idx] = texture[(y - rect->y) * rect->width + x - rect->x];
-                if (surface->backbuf[idx] == TEST_XRGB_WHITE) {
-                    surface->backbuf[idx] = extra_color;
-                }
+        for (uint32_t y = 0; y < clip.height; ++y) {
+            uint32_t *dst = surface->backbuf + (clip.y + y) * surface->width + clip.x;
+            const uint32_t *src = texture + (ty + y) * rect->width + tx;
+            for (uint32_t x = 0; x < clip.width; ++x) {
+                dst[x] = src[x] == TEST_XRGB_WHITE ? extra_color : src[x];
+            }
+        }
+    }
+}
 
+void
+surface_fill_rect_alpha(struct surface_t *surface, const rect_t *rect, uint32_t color, uint8_t alpha) {
+    rect_t clip;
+    if (!surface_clip_rect(surface, rect, &clip)) {
+        return;
+    }
+
+    if (alpha == 0xFF) {
+        surface_fill_rect(surface, &clip, color);
+        return;
+    }
+
+    uint32_t src = pixel_premultiply(color, alpha);
+    uint64_t src2 = src | ((uint64_t)src << 32);
+    uint32_t inv_alpha = 0xFF - alpha;
+
+    for (uint32_t y = clip.y; y < clip.y + clip.height; ++y) {
+        uint32_t *row = surface->backbuf + y * surface->width + clip.x;
+        uint32_t n = clip.width;
+
+        for (; n >= 2; n -= 2, row += 2) {
+            pixel2_t *pp = (pixel2_t *)row;
+            *pp = pixel_scale2(*pp, inv_alpha) + src2;
+        }
+        if (n) {
+            *row = pixel_scale(*row, inv_alpha) + src;
+        }
+    }
+}
+
+void
+surface_blend_texture(struct surface_t *surface, const rect_t *rect, const uint32_t *texture, uint8_t opacity) {
+    rect_t clip;
+    if (!surface_clip_rect(surface, rect, &clip)) {
+        return;
+    }
+
+    for (uint32_t y = 0; y < clip.height; ++y) {
+        uint32_t *dst = surface->backbuf + (clip.y + y) * surface->width + clip.x;
+        const uint32_t *src = texture + (clip.y - rect->y + y) * rect->width + clip.x - rect->x;
+
+        for (uint32_t x = 0; x < clip.width; ++x) {
+            uint32_t pixel = src[x];
+            if (opacity != 0xFF) {
+                pixel = pixel_scale(pixel, opacity);
+            }
+
+            /* Most of the sprite pixels are either transparent or opaque */
+            uint32_t alpha = PIXEL_A(pixel);
+            if (alpha == 0xFF) {
+                dst[x] = pixel;
+            } else if (alpha) {
+                dst[x] = pixel_over(dst[x], pixel);
             }
         }
     }
 }
 
 void
-load_font(struct font_t *font) {
-    struct font_header_t *header = (struct font_header_t *)__bin_start;
-    assert(header->magic == FONT_MAGIC_NUM);
+surface_blit_format(struct surface_t *surface, const rect_t *rect, const void *texture,
+                    enum pixel_format format, size_t stride) {
+    rect_t clip;
+    if (!surface_clip_rect(surface, rect, &clip)) {
+        return;
+    }
 
-    font->char_height = header->char_height;
-    font->char_width = header->char_width;
+    const char *src = (const char *)texture + (clip.y - rect->y) * stride +
+                      (clip.x - rect->x) * pixfmt_size(format);
 
-    font->bitmaps = (struct xrgb_pixel *)(((char *)header) + sizeof(struct font_header_t));
+    for (uint32_t y = 0; y < clip.height; ++y, src += stride) {
+        pixfmt_to_native(surface->backbuf + (clip.y + y) * surface->width + clip.x, src, format, clip.width);
+    }
 }
 
-static void
-surface_draw_character(struct surface_t *surface, struct font_t *font, char ch, uint32_t pos_x, uint32_t pos_y) {
-    struct xrgb_pixel *bitmap_array = font->bitmaps + font->char_height * font->char_width * FONT_INDEX(ch);
+static inline void
+blit_store(uint32_t *dst, uint32_t pixel, int flags) {
+    if (!(flags & BLIT_BLEND)) {
+        *dst = pixel;
+        return;
+    }
+
+    uint32_t alpha = PIXEL_A(pixel);
+    if (alpha == 0xFF) {
+        *dst = pixel;
+    } else if (alpha) {
+        *dst = pixel_over(*dst, pixel);
+    }
+}
+
+/* Texture coordinates are stepped in 16.16 fixed point. Nearest samples
+ * the texel under the destination pixel center, bilinear mixes the four
+ * texels around it with 8-bit weights. */
+void
+surface_blit_scaled(struct surface_t *surface, const rect_t *rect, const uint32_t *texture,
+                    uint32_t tex_w, uint32_t tex_h, uint32_t stride, int flags) {
+    rect_t clip;
+    if (!tex_w || !tex_h || !surface_clip_rect(surface, rect, &clip)) {
+        return;
+    }
+
+    int64_t step_x = ((int64_t)tex_w << 16) / rect->width;
+    int64_t step_y = ((int64_t)tex_h << 16) / rect->height;
+    /* first clipped pixel relative to the rect */
+    uint32_t off_x = clip.x - rect->x;
+    uint32_t off_y = clip.y - rect->y;
+
+    for (uint32_t y = 0; y < clip.height; ++y) {
+        uint32_t *dst = surface->backbuf + (clip.y + y) * surface->width + clip.x;
+        int64_t v = step_y * (off_y + y) + step_y / 2;
+
+        if (!(flags & BLIT_BILINEAR)) {
+            const uint32_t *row = texture + MIN(v >> 16, tex_h - 1) * stride;
+
+            for (uint32_t x = 0; x < clip.width; ++x) {
+                int64_t tx = MIN((step_x * (off_x + x) + step_x / 2) >> 16, tex_w - 1);
+                if (flags & BLIT_MIRROR) {
+                    tx = tex_w - 1 - tx;
+                }
+                blit_store(dst + x, row[tx], flags);
+            }
+            continue;
+        }
+
+        /* sample positions are shifted by half a texel to hit texel centers */
+        v = MAX(v - 0x8000, 0);
+        uint32_t ty = MIN(v >> 16, tex_h - 1);
+        uint32_t wy = (v >> 8) & 0xFF;
+        const uint32_t *row0 = texture + ty * stride;
+        const uint32_t *row1 = texture + MIN(ty + 1, tex_h - 1) * stride;
 
-    for (int y = 0; y < font->char_height; ++y) {
-        for (int x = 0; x < font->char_width; ++x) {
-            struct xrgb_pixel *bitmap_pixel = bitmap_array + y * font->char_width + x;
+        for (uint32_t x = 0; x < clip.width; ++x) {
+            int64_t u = MAX(step_x * (off_x + x) + step_x / 2 - 0x8000, 0);
+            uint32_t tx0 = MIN(u >> 16, tex_w - 1);
+            uint32_t tx1 = MIN(tx0 + 1, tex_w - 1);
+            uint32_t wx = (u >> 8) & 0xFF;
 
-            if (bitmap_pixel->is_enabled) {
-                surface->backbuf[(pos_y + y) * surface->width + pos_x + x] = bitmap_pixel->xrgb_val;
+            if (flags & BLIT_MIRROR) {
+                tx0 = tex_w - 1 - tx0;
+                tx1 = tex_w - 1 - tx1;
             }
+
+            uint32_t top = pixel_lerp(row0[tx0], row0[tx1], wx);
+            uint32_t bottom = pixel_lerp(row1[tx0], row1[tx1], wx);
+            blit_store(dst + x, pixel_lerp(top, bottom, wy), flags);
         }
     }
 }
 
-uint32_t
-surface_draw_text(struct surface_t *surface, struct font_t *font, const char *str, uint32_t x, uint32_t y) {
-    while (*str) {
-        surface_draw_character(surface, font, *str, x, y);
-        x += font->char_width;
-        str++;
+void
+surface_fade_rect(struct surface_t *surface, const rect_t *rect, uint8_t alpha) {
+    rect_t clip;
+    if (!surface_clip_rect(surface, rect, &clip)) {
+        return;
     }
 
-    return x;
+    for (uint32_t y = clip.y; y < clip.y + clip.height; ++y) {
+        uint32_t *row = surface->backbuf + y * surface->width + clip.x;
+        uint32_t n = clip.width;
+
+        for (; n >= 2; n -= 2, row += 2) {
+            pixel2_t *pp = (pixel2_t *)row;
+            *pp = pixel_scale2(*pp, alpha);
+        }
+        if (n) {
+            *row = pixel_scale(*row, alpha);
+        }
+    }
+}
+
+uint32_t
+surface_checksum(const struct surface_t *surface) {
+    return crc32c(0, surface->backbuf, (size_t)surface->width * surface->height * sizeof(*surface->backbuf));
+}
+
+void
+surface_end_frame(struct surface_t *surface) {
+    surface->frames++;
+
+    if (gfx_headless && surface_is_offscreen(surface)) {
+        cprintf("frame: n=%u crc32c=%08x\n", surface->frames, surface_checksum(surface));
+    }
 }
 
 void
@@ -6,6 +6,7 @@
 #include "virtio-gpu.h"
 #include "virtio-queue.h"
 #include "font.h"
+#include "pixfmt.h"
 
 #define MAX_WINDOW_WIDTH  640
 #define MAX_WINDOW_HEIGHT 480
@@ -19,29 +20,65 @@
 
 #define XRGB_DEFAULT_COLOR TEST_XRGB_BLACK
 
+typedef struct virtio_gpu_rect rect_t;
+
 struct surface_t {
+    /* 0 for offscreen surfaces, they have no host resource */
     uint32_t resource_id;
 
     /* buffer size */
     uint32_t width;
     uint32_t height;
 
+    /* drawing primitives only touch pixels inside clip */
+    rect_t clip;
+
+    /* format of the host resource, backbuf is always PIXFMT_NATIVE */
+    enum pixel_format format;
+
+    /* frames ended with surface_end_frame() */
+    uint32_t frames;
+
     // because we don't have malloc :(
     uint32_t backbuf[MAX_WINDOW_WIDTH * MAX_WINDOW_HEIGHT];
 };
 
+/* Host format for surface_init(), must be one the host supports */
+extern enum pixel_format surface_host_format;
+
+/* Headless mode: surface_init() makes offscreen surfaces and ended frames
+ * are reported with their checksum on serial. Turned on by CONFIG_HEADLESS=y
+ * or when there is no GPU */
+extern bool gfx_headless;
+
 void surface_init(struct surface_t *surface, uint32_t buf_w, uint32_t buf_h);
+void surface_init_format(struct surface_t *surface, uint32_t buf_w, uint32_t buf_h, enum pixel_format format);
 void surface_display(struct surface_t *surface);
 void surface_update_rect(struct surface_t *surface, uint32_t x, uint32_t y, uint32_t width, uint32_t height);
 void surface_destroy(struct surface_t *surface);
 
-typedef struct virtio_gpu_rect rect_t;
+/* Surface that is never presented, 0 size means MAX_WINDOW_* */
+void surface_init_offscreen(struct surface_t *surface, uint32_t buf_w, uint32_t buf_h);
+bool surface_is_offscreen(const struct surface_t *surface);
+
+/* CRC32C of the backbuf */
+uint32_t surface_checksum(const struct surface_t *surface);
+/* Called once a frame is complete, prints "frame: n=... crc32c=..." in headless mode */
+void surface_end_frame(struct surface_t *surface);
+
+/* NULL clip resets it to the whole surface */
+void surface_set_clip(struct surface_t *surface, const rect_t *clip);
+bool surface_clip_rect(const struct surface_t *surface, const rect_t *rect, rect_t *clipped);
 
 struct font_t {
     uint32_t char_width;
     uint32_t char_height;
 
-    struct xrgb_pixel *bitmaps;
+    /* packed glyph coverage, see struct packed_font_header_t */
+    uint32_t bpp;
+    uint32_t row_size;
+    uint32_t glyph_size;
+    const uint8_t *glyphs;
 };
 
 struct vector {
@@ -49,6 +86,12 @@ struct vector {
     uint64_t y;
 };
 
+/* Signed, so shapes may stick out of the surface */
+typedef struct point {
+    int32_t x;
+    int32_t y;
+} point_t;
+
 
 struct surface_t *get_main_surface();
 struct font_t *get_main_font();
@@ -60,15 +103,73 @@ surface_draw_circle(struct surface_t *resource, uint64_t x, uint64_t y, uint64_t
 void
 surface_fill_rect(struct surface_t *surface, const rect_t *rect, uint32_t color);
 
+/* Fill pixels [x0, x1) of row y, the span is clipped. All filled shapes end up here */
+void
+surface_fill_span(struct surface_t *surface, int32_t x0, int32_t x1, int32_t y, uint32_t color);
+
+/* Lines include both end points, width <= 1 draws a plain Bresenham line */
+void
+surface_draw_line(struct surface_t *surface, point_t p0, point_t p1, uint32_t width, uint32_t color);
+
+void
+surface_draw_polyline(struct surface_t *surface, const point_t *points, size_t npoints, uint32_t width, uint32_t color);
+
+/* Vertices go in order (either winding), polygon must be convex */
+void
+surface_fill_convex_polygon(struct surface_t *surface, const point_t *points, size_t npoints, uint32_t color);
+
 void
 surface_fill_texture(struct surface_t *surface, const rect_t *rect, uint32_t *texture, int y_mirror, uint32_t extra_color);
 
+/* Alpha-blended primitives, colors are opaque XRGB and alpha is 0..255 */
+void
+surface_fill_rect_alpha(struct surface_t *surface, const rect_t *rect, uint32_t color, uint8_t alpha);
+
+/* Texture pixels are premultiplied ARGB, opacity is applied on top of them */
+void
+surface_blend_texture(struct surface_t *surface, const rect_t *rect, const uint32_t *texture, uint8_t opacity);
+
+/* Copy a texture stored in any format, stride is in bytes */
+void
+surface_blit_format(struct surface_t *surface, const rect_t *rect, const void *texture,
+                    enum pixel_format format, size_t stride);
+
+/* Scaled blit flags */
+#define BLIT_BILINEAR 0x1 /* filter, nearest sample otherwise */
+#define BLIT_MIRROR   0x2 /* flip horizontally */
+#define BLIT_BLEND    0x4 /* texture is premultiplied ARGB, blend instead of copy */
+
+/* Stretch tex_w x tex_h texture (rows are stride pixels apart) onto rect */
+void
+surface_blit_scaled(struct surface_t *surface, const rect_t *rect, const uint32_t *texture,
+                    uint32_t tex_w, uint32_t tex_h, uint32_t stride, int flags);
+
+/* Scale pixels inside rect by alpha / 255 (fade to black) */
+void
+surface_fade_rect(struct surface_t *surface, const rect_t *rect, uint8_t alpha);
+
 void
 load_font(struct font_t *font);
 
+/* Both return x right after the last character, text is white by default.
+ * The font only keeps glyph coverage, so its own pixel colors are gone and
+ * antialiased edges are blended over the surface instead of drawn gray. */
 uint32_t
 surface_draw_text(struct surface_t *surface, struct font_t *font, const char *str, uint32_t x, uint32_t y);
 
+uint32_t
+surface_draw_text_color(struct surface_t *surface, struct font_t *font, const char *str, uint32_t x, uint32_t y, uint32_t color);
+
+/* Text with glyphs stretched to char_width x char_height pixels */
+uint32_t
+surface_draw_text_scaled(struct surface_t *surface, struct font_t *font, const char *str, uint32_t x, uint32_t y,
+                         uint32_t char_width, uint32_t char_height, uint32_t color);
+
+/* Draw len characters of str in one pass, see kern/text.h for layout */
+uint32_t
+surface_draw_text_run(struct surface_t *surface, struct font_t *font, const char *str, size_t len,
+                      uint32_t x, uint32_t y, uint32_t color);
+
 void
 surface_clear(struct surface_t *surface, uint32_t color);
 
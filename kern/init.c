@@ -150,13 +150,17 @@ i386_init(void) {
     timers_init();
 
     /* Framebuffer init should be done after memory init */
-    // fb_init();
-    // if (trace_init) cprintf("Framebuffer initialised\n");
+    fb_init();
+    if (trace_init) cprintf("Framebuffer initialised\n");
 
     // GPU Lab
     
     /* User environment initialization functions */
     env_init();
+    trap_init();
+
+    check_lazy_alloc();
+    if (trace_init) cprintf("Lazy allocation is correct\n");
 
     /* Choose the timer used for scheduling: hpet or pit */
     timers_schedule("hpet1");
@@ -0,0 +1,104 @@
+/* Kernel log ring, see klog.h */
+
+#include <inc/stdio.h>
+#include <inc/string.h>
+#include <inc/x86.h>
+
+#include "klog.h"
+#include "tsc.h"
+
+static struct {
+    /* sequence numbers, free running */
+    uint32_t head;    /* next record to write */
+    uint32_t drained; /* next record to print */
+    struct klog_record records[KLOG_RECORDS];
+} klog_ring;
+
+static const char *const klog_level_names[KLOG_NLEVELS] = {
+        [KLOG_ERR] = "err",
+        [KLOG_WARN] = "warn",
+        [KLOG_INFO] = "info",
+        [KLOG_DEBUG] = "debug",
+};
+
+static void
+klog_print(const struct klog_record *rec) {
+    cprintf("%.*s\n", rec->len, rec->text);
+}
+
+void
+klog(enum klog_level level, const char *fmt, ...) {
+    extern const char *panicstr;
+    struct klog_record *rec = &klog_ring.records[klog_ring.head % KLOG_RECORDS];
+    va_list ap;
+
+    va_start(ap, fmt);
+    int len = vsnprintf(rec->text, sizeof(rec->text), fmt, ap);
+    va_end(ap);
+
+    len = MIN(MAX(len, 0), KLOG_LINE - 1);
+    if (len && rec->text[len - 1] == '\n') len--;
+
+    rec->tsc = read_tsc();
+    rec->level = level;
+    rec->len = len;
+    klog_ring.head++;
+
+    if (panicstr) {
+        klog_drain(KLOG_RECORDS);
+    }
+}
+
+void
+klog_drain(uint32_t max) {
+    if (klog_ring.head - klog_ring.drained > KLOG_RECORDS) {
+        uint32_t lost = klog_ring.head - klog_ring.drained - KLOG_RECORDS;
+        klog_ring.drained += lost;
+        cprintf("klog: %u messages lost\n", lost);
+    }
+
+    for (; max && klog_ring.drained != klog_ring.head; max--) {
+        klog_print(&klog_ring.records[klog_ring.drained++ % KLOG_RECORDS]);
+    }
+}
+
+void
+klog_skip(void) {
+    klog_ring.drained = klog_ring.head;
+}
+
+/* There is no strstr() */
+static bool
+klog_match(const struct klog_record *rec, const char *match) {
+    size_t n = strlen(match);
+
+    for (size_t i = 0; i + n <= rec->len; i++) {
+        if (!strncmp(rec->text + i, match, n)) return true;
+    }
+    return false;
+}
+
+void
+klog_dump(enum klog_level max_level, const char *match) {
+    uint64_t cycles_us = MAX(tsc_calibrate() / 1000000, 1);
+    uint32_t seq = klog_ring.head > KLOG_RECORDS ? klog_ring.head - KLOG_RECORDS : 0;
+
+    for (; seq != klog_ring.head; seq++) {
+        const struct klog_record *rec = &klog_ring.records[seq % KLOG_RECORDS];
+        uint64_t us = rec->tsc / cycles_us;
+
+        if (rec->level > max_level || (match && !klog_match(rec, match))) {
+            continue;
+        }
+        cprintf("[%5lu.%06lu] %s: %.*s\n", (unsigned long)(us / 1000000), (unsigned long)(us % 1000000),
+                klog_level_names[rec->level], rec->len, rec->text);
+    }
+}
+
+int
+klog_level_parse(const char *name) {
+    for (int i = 0; i < KLOG_NLEVELS; i++) {
+        if (!strcmp(name, klog_level_names[i])) return i;
+    }
+    return -1;
+}
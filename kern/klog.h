@@ -0,0 +1,52 @@
+#pragma once
+
+#include <inc/types.h>
+
+/**
+ * Kernel log ring.
+ *
+ * klog() formats the message into the next slot of a ring of fixed size
+ * records, stamped with the TSC and a level, and returns without touching
+ * the consoles. Records are printed later by klog_drain(), a few at a
+ * time, when the console waits for input, so logging from the trap path
+ * or the page allocator costs a vsnprintf() instead of port I/O. After a
+ * panic records are printed right away.
+ *
+ * When writers lap the drain, the overwritten records are reported as
+ * lost. The ring keeps the last KLOG_RECORDS messages for klog_dump(),
+ * behind the dmesg monitor command.
+ */
+
+#define KLOG_RECORDS      512 /* power of two */
+#define KLOG_LINE         120
+#define KLOG_DRAIN_BUDGET 8
+
+enum klog_level {
+    KLOG_ERR,
+    KLOG_WARN,
+    KLOG_INFO,
+    KLOG_DEBUG,
+    KLOG_NLEVELS,
+};
+
+struct klog_record {
+    uint64_t tsc;
+    uint8_t level;
+    uint8_t len;
+    char text[KLOG_LINE]; /* without the trailing newline */
+};
+
+/* A message per call, a trailing newline is dropped */
+void klog(enum klog_level level, const char *fmt, ...) __attribute__((format(printf, 2, 3)));
+
+/* Prints up to max records not printed yet */
+void klog_drain(uint32_t max);
+
+/* Marks all records as printed without printing them */
+void klog_skip(void);
+
+/* "[sec.usec] level: text" for records up to max_level containing match (any if NULL) */
+void klog_dump(enum klog_level max_level, const char *match);
+
+/* Level by name, -1 if there is none */
+int klog_level_parse(const char *name);
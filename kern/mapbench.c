@@ -0,0 +1,134 @@
+/* Memory mapping benchmark: map_region()/unmap_region() and TLB reach of page sizes,
+ * collected by ./grade-bench mapbench */
+
+#include <inc/stdio.h>
+#include <inc/string.h>
+#include <inc/error.h>
+
+#include "bench.h"
+#include "pmap.h"
+
+#define MAPBENCH_TAG "mapbench"
+
+/* Unused PML4 slot, nothing else is mapped there */
+#define MAPBENCH_VA (2ULL << PML4_SHIFT)
+
+#define MAP_SIZE   HUGE_PAGE_SIZE
+#define TOUCH_SIZE (32 * MB)
+
+/* Huge page aligned memory of the kernel image, mapped without references */
+#define MAP_PHYS PADDR(zero_page_raw)
+
+/* A page offset defeats 2M alignment, so the region is mapped with 4K pages */
+static uintptr_t touch_va[2] = {MAPBENCH_VA, MAPBENCH_VA + GB + PAGE_SIZE};
+static volatile uint64_t touch_sum;
+
+static void
+op_map_4k(void *arg, uint32_t iteration) {
+    map_region(&kspace, MAPBENCH_VA + PAGE_SIZE, NULL, MAP_PHYS, MAP_SIZE, PROT_R);
+    unmap_region(&kspace, MAPBENCH_VA + PAGE_SIZE, MAP_SIZE);
+}
+
+static void
+op_map_2m(void *arg, uint32_t iteration) {
+    map_region(&kspace, MAPBENCH_VA, NULL, MAP_PHYS, MAP_SIZE, PROT_R);
+    unmap_region(&kspace, MAPBENCH_VA, MAP_SIZE);
+}
+
+/* Zeroed memory is committed by write faults, one per page */
+static void
+fault_in(uintptr_t va) {
+    map_region(&kspace, va, NULL, 0, MAP_SIZE, PROT_R | PROT_W | ALLOC_ZERO);
+    for (uintptr_t off = 0; off < MAP_SIZE; off += PAGE_SIZE) {
+        *(volatile uint8_t *)(va + off) = 1;
+    }
+    unmap_region(&kspace, va, MAP_SIZE);
+}
+
+static void
+op_fault_4k(void *arg, uint32_t iteration) {
+    fault_in(MAPBENCH_VA + PAGE_SIZE);
+}
+
+static void
+op_fault_2m(void *arg, uint32_t iteration) {
+    fault_in(MAPBENCH_VA);
+}
+
+/* Unmaps a 4K page out of a huge page and maps it back */
+static void
+op_split_2m(void *arg, uint32_t iteration) {
+    map_region(&kspace, MAPBENCH_VA, NULL, MAP_PHYS, MAP_SIZE, PROT_R);
+    unmap_region(&kspace, MAPBENCH_VA + (iteration % 512) * PAGE_SIZE, PAGE_SIZE);
+    unmap_region(&kspace, MAPBENCH_VA, MAP_SIZE);
+}
+
+/* One load per 4K page in a scattered order, so every load misses the TLB
+ * unless the pages are huge */
+static void
+op_touch(void *arg, uint32_t iteration) {
+    const uint8_t *base = (const uint8_t *)*(uintptr_t *)arg;
+    const size_t pages = TOUCH_SIZE / PAGE_SIZE;
+    uint64_t sum = 0;
+
+    for (size_t i = 0; i < pages; i++) {
+        sum += *(volatile const uint64_t *)(base + ((i * 7919 + iteration) % pages) * PAGE_SIZE);
+    }
+    touch_sum = sum;
+}
+
+static const struct {
+    const char *name;
+    bench_fn fn;
+} map_ops[] = {
+        {"map_4k", op_map_4k},
+        {"map_2m", op_map_2m},
+        {"fault_4k", op_fault_4k},
+        {"fault_2m", op_fault_2m},
+        {"split_2m", op_split_2m},
+};
+
+#define MAP_NOPS (sizeof(map_ops) / sizeof(map_ops[0]))
+
+int
+mapbench(uint32_t iters) {
+    if (!iters || iters > BENCH_MAX_SAMPLES) {
+        return -E_INVAL;
+    }
+
+    cprintf("%s: start iters=%u warmup=%u cpu_freq=%lu\n", MAPBENCH_TAG, iters, BENCH_WARMUP,
+            (unsigned long)bench_cpu_freq());
+
+    for (size_t i = 0; i < MAP_NOPS; i++) {
+        struct bench_result res;
+
+        bench_run(&res, map_ops[i].name, map_ops[i].fn, NULL, iters, 0);
+        bench_report(MAPBENCH_TAG, &res);
+    }
+
+    /* The same memory through huge pages and through 4K pages,
+     * committed up front so loads don't all hit the one shared filler page */
+    int err = map_region(&kspace, touch_va[0], NULL, 0, TOUCH_SIZE, PROT_R | PROT_W | ALLOC_ONE);
+    for (uintptr_t off = 0; !err && off < TOUCH_SIZE; off += HUGE_PAGE_SIZE) {
+        err = force_alloc_page(&kspace, touch_va[0] + off, MAX_ALLOCATION_CLASS);
+    }
+    if (!err) err = map_region(&kspace, touch_va[1], &kspace, touch_va[0], TOUCH_SIZE, PROT_R);
+
+    if (err) {
+        cprintf("%s: touch: %i\n", MAPBENCH_TAG, err);
+    } else {
+        static const char *const names[] = {"touch_2m", "touch_4k"};
+
+        for (size_t i = 0; i < 2; i++) {
+            struct bench_result res;
+
+            bench_run(&res, names[i], op_touch, &touch_va[i], iters, 0);
+            bench_report(MAPBENCH_TAG, &res);
+        }
+    }
+    unmap_region(&kspace, touch_va[1], TOUCH_SIZE);
+    unmap_region(&kspace, touch_va[0], TOUCH_SIZE);
+
+    cprintf("%s: done\n", MAPBENCH_TAG);
+    return 0;
+}
@@ -7,6 +7,7 @@
 #include <inc/assert.h>
 #include <inc/env.h>
 #include <inc/x86.h>
+#include <inc/error.h>
 
 #include <kern/console.h>
 #include <kern/monitor.h>
@@ -20,6 +21,13 @@
 
 #include <kern/pong.h>
 #include <kern/graphic.h>
+#include <kern/text.h>
+#include <kern/bench.h>
+#include <kern/profiler.h>
+#include <kern/replay.h>
+#include <kern/gpucons.h>
+#include <kern/klog.h>
+#include <kern/trace.h>
 
 #define WHITESPACE "\t\r\n "
 #define MAXARGS    16
@@ -29,6 +37,16 @@ int mon_help(int argc, char **argv, struct Trapframe *tf);
 int mon_pong(int argc, char **argv, struct Trapframe *tf);
 int mon_font(int argc, char **argv, struct Trapframe *tf);
 int mon_example(int argc, char **argv, struct Trapframe *tf);
+int mon_pixfmt(int argc, char **argv, struct Trapframe *tf);
+int mon_gfxbench(int argc, char **argv, struct Trapframe *tf);
+int mon_fmtbench(int argc, char **argv, struct Trapframe *tf);
+int mon_mapbench(int argc, char **argv, struct Trapframe *tf);
+int mon_headless(int argc, char **argv, struct Trapframe *tf);
+int mon_prof(int argc, char **argv, struct Trapframe *tf);
+int mon_replay(int argc, char **argv, struct Trapframe *tf);
+int mon_gpucons(int argc, char **argv, struct Trapframe *tf);
+int mon_dmesg(int argc, char **argv, struct Trapframe *tf);
+int mon_trace(int argc, char **argv, struct Trapframe *tf);
 
 struct Command {
     const char *name;
@@ -39,9 +57,19 @@ struct Command {
 
 static struct Command commands[] = {
         {"help",    "Display this list of commands", mon_help},
-        {"pong",    "Start playing pong",            mon_pong},
+        {"pong",    "Start playing pong: pong [frames] [stress balls]", mon_pong},
         {"font",    "Display string on screen",      mon_font},
         {"example", "Best example",                  mon_example},
+        {"pixfmt",  "Show or set host pixel format", mon_pixfmt},
+        {"gfxbench", "Benchmark graphics: gfxbench [iters] [op]", mon_gfxbench},
+        {"fmtbench", "Benchmark snprintf: fmtbench [iters]", mon_fmtbench},
+        {"mapbench", "Benchmark page mapping: mapbench [iters]", mon_mapbench},
+        {"headless", "Render offscreen with frame checksums: headless [on|off]", mon_headless},
+        {"prof",    "Frame profiler output: prof [off|hud|serial|all]", mon_prof},
+        {"replay",  "Pong input replay: replay [off|record|play|dump]", mon_replay},
+        {"gpucons", "Console output on the GPU: gpucons [on|off]", mon_gpucons},
+        {"dmesg",   "Dump the kernel log: dmesg [err|warn|info|debug] [text]", mon_dmesg},
+        {"trace",   "Tracepoints: trace [on|off|clear|dump [n]|export] [event...]", mon_trace},
 };
 
 #define NCOMMANDS (sizeof(commands) / sizeof(commands[0]))
@@ -58,7 +86,8 @@ mon_help(int argc, char **argv, struct Trapframe *tf) {
 int
 mon_pong(int argc, char **argv, struct Trapframe *tf) {
     cprintf("starting pong\n");
-    return pong();
+    return pong(argc > 1 ? strtol(argv[1], NULL, 0) : 0,
+                argc > 2 ? strtol(argv[2], NULL, 0) : 0);
 }    
 
 int mon_font(int argc, char **argv, struct Trapframe *tf){
@@ -74,12 +103,19 @@ int mon_font(int argc, char **argv, struct Trapframe *tf){
     struct surface_t* main_srf_ptr = get_main_surface();
     surface_clear(main_srf_ptr, XRGB_DEFAULT_COLOR); 
 
-    uint32_t pos = 0;
+    static struct text_layout layout;
+    rect_t screen = {0, 0, main_srf_ptr->width, main_srf_ptr->height};
+    text_layout_init(&layout, font, &screen, TEXT_ALIGN_LEFT);
+
     for (int i = 1; i < argc; ++i) {
-        pos = surface_draw_text(main_srf_ptr, font, argv[i], pos, 0);
-        pos += font->char_width; // for space
+        if (text_layout_add(&layout, argv[i], TEST_XRGB_WHITE) < 0 ||
+            (i + 1 < argc && text_layout_add(&layout, " ", TEST_XRGB_WHITE) < 0)) {
+            cprintf("Text doesn't fit on screen, cut\n");
+            break;
+        }
     }
 
+    text_layout_draw(main_srf_ptr, &layout, NULL);
     surface_display(main_srf_ptr);
     return 0;
 }
@@ -99,8 +135,8 @@ int mon_example(int argc, char **argv, struct Trapframe *tf) {
     struct font_t font;
     load_font(&font);
 
-    surface_draw_text(&surface,  &font, "osdev isn't dead", 200, 200);
-    surface_draw_text(&surface2, &font, "osdev", 200, 200);
+    surface_draw_text_color(&surface,  &font, "osdev isn't dead", 200, 200, TEST_XRGB_WHITE);
+    surface_draw_text_color(&surface2, &font, "osdev", 200, 200, TEST_XRGB_WHITE);
 
     for (int i = 0; i < 10; i++) {
         surface_display(&surface);
@@ -110,7 +146,7 @@ int mon_example(int argc, char **argv, struct Trapframe *tf) {
     }
 
     surface_clear(&surface, XRGB_DEFAULT_COLOR);
-    surface_draw_text(&surface, &font, "END OF DEMO", 200, 200);
+    surface_draw_text_color(&surface, &font, "END OF DEMO", 200, 200, TEST_XRGB_WHITE);
     surface_display(&surface);
     
     surface_clear(&surface,  XRGB_DEFAULT_COLOR);
@@ -118,6 +154,226 @@ int mon_example(int argc, char **argv, struct Trapframe *tf) {
     return 0;
 }
 
+int
+mon_pixfmt(int argc, char **argv, struct Trapframe *tf) {
+    if (argc < 2) {
+        cprintf("host format: %s\n", pixfmt_name(surface_host_format));
+        return 0;
+    }
+
+    for (enum pixel_format format = 0; format < PIXFMT_COUNT; format++) {
+        if (!strcmp(argv[1], pixfmt_name(format))) {
+            if (!pixfmt_virtio_format(format)) {
+                cprintf("%s can't be a host format\n", argv[1]);
+                return 0;
+            }
+            /* new surfaces only */
+            surface_host_format = format;
+            return 0;
+        }
+    }
+
+    cprintf("Unknown format '%s', one of:", argv[1]);
+    for (enum pixel_format format = 0; format < PIXFMT_COUNT; format++) {
+        cprintf(" %s", pixfmt_name(format));
+    }
+    cprintf("\n");
+    return 0;
+}
+
+int
+mon_gfxbench(int argc, char **argv, struct Trapframe *tf) {
+    uint32_t iters = argc > 1 ? strtol(argv[1], NULL, 0) : 100;
+    const char *filter = argc > 2 ? argv[2] : NULL;
+
+    if (gfxbench(iters, filter) < 0) {
+        cprintf("Iterations should be 1..%d\n", BENCH_MAX_SAMPLES);
+    }
+    return 0;
+}
+
+int
+mon_fmtbench(int argc, char **argv, struct Trapframe *tf) {
+    uint32_t iters = argc > 1 ? strtol(argv[1], NULL, 0) : 100;
+
+    /* failed checks are reported by fmtbench itself */
+    if (fmtbench(iters) == -E_INVAL) {
+        cprintf("Iterations should be 1..%d\n", BENCH_MAX_SAMPLES);
+    }
+    return 0;
+}
+
+int
+mon_mapbench(int argc, char **argv, struct Trapframe *tf) {
+    uint32_t iters = argc > 1 ? strtol(argv[1], NULL, 0) : 100;
+
+    if (mapbench(iters) < 0) {
+        cprintf("Iterations should be 1..%d\n", BENCH_MAX_SAMPLES);
+    }
+    return 0;
+}
+
+int
+mon_headless(int argc, char **argv, struct Trapframe *tf) {
+    if (argc > 1) {
+        if (!strcmp(argv[1], "on")) {
+            gfx_headless = true;
+        } else if (!strcmp(argv[1], "off")) {
+            gfx_headless = false;
+        } else {
+            cprintf("Usage: headless [on|off]\n");
+            return 0;
+        }
+    }
+
+    /* applies to surfaces created from now on */
+    cprintf("headless: %s\n", gfx_headless ? "on" : "off");
+    return 0;
+}
+
+int
+mon_prof(int argc, char **argv, struct Trapframe *tf) {
+    static const struct {
+        const char *name;
+        int flags;
+    } modes[] = {
+            {"off", 0},
+            {"hud", PROF_SHOW_HUD},
+            {"serial", PROF_SHOW_SERIAL},
+            {"all", PROF_SHOW_HUD | PROF_SHOW_SERIAL},
+    };
+
+    /* stats of the last profiled run */
+    if (argc < 2) {
+        prof_dump();
+        return 0;
+    }
+
+    for (size_t i = 0; i < sizeof(modes) / sizeof(modes[0]); i++) {
+        if (!strcmp(argv[1], modes[i].name)) {
+            prof_flags = modes[i].flags;
+            return 0;
+        }
+    }
+
+    cprintf("Usage: prof [off|hud|serial|all]\n");
+    return 0;
+}
+
+int
+mon_replay(int argc, char **argv, struct Trapframe *tf) {
+    static const char *const modes[] = {
+            [REPLAY_OFF] = "off",
+            [REPLAY_RECORD] = "record",
+            [REPLAY_PLAY] = "play",
+    };
+
+    if (argc > 1 && !strcmp(argv[1], "dump")) {
+        replay_dump();
+        return 0;
+    }
+
+    if (argc > 1) {
+        size_t i = 0;
+        while (i < sizeof(modes) / sizeof(modes[0]) && strcmp(argv[1], modes[i])) i++;
+
+        if (i == sizeof(modes) / sizeof(modes[0])) {
+            cprintf("Usage: replay [off|record|play|dump]\n");
+            return 0;
+        }
+        /* takes effect with the next game */
+        replay_mode = i;
+    }
+
+    cprintf("replay: %s\n", modes[replay_mode]);
+    return 0;
+}
+
+int
+mon_gpucons(int argc, char **argv, struct Trapframe *tf) {
+    if (argc > 1) {
+        if (!strcmp(argv[1], "on")) {
+            gpucons_enable(true);
+        } else if (!strcmp(argv[1], "off")) {
+            gpucons_enable(false);
+        } else {
+            cprintf("Usage: gpucons [on|off]\n");
+            return 0;
+        }
+    }
+
+    cprintf("gpucons: %s\n", gpucons_enabled() ? "on" : "off");
+    return 0;
+}
+
+int
+mon_dmesg(int argc, char **argv, struct Trapframe *tf) {
+    int level = argc > 1 ? klog_level_parse(argv[1]) : KLOG_DEBUG;
+
+    if (level < 0) {
+        cprintf("Usage: dmesg [err|warn|info|debug] [text]\n");
+        return 0;
+    }
+
+    /* An unfiltered dump shows the queued records too, don't print them
+     * twice. A filtered one may leave some out, so print them first. */
+    if (argc > 1)
+        klog_drain(KLOG_RECORDS);
+    else
+        klog_skip();
+    klog_dump(level, argc > 2 ? argv[2] : NULL);
+    return 0;
+}
+
+int
+mon_trace(int argc, char **argv, struct Trapframe *tf) {
+    if (argc > 1 && !strcmp(argv[1], "clear")) {
+        trace_clear();
+        return 0;
+    }
+    if (argc > 1 && !strcmp(argv[1], "dump")) {
+        trace_dump(argc > 2 ? strtol(argv[2], NULL, 0) : 0);
+        return 0;
+    }
+    if (argc > 1 && !strcmp(argv[1], "export")) {
+        trace_export();
+        return 0;
+    }
+
+    if (argc > 1) {
+        bool on = !strcmp(argv[1], "on");
+        uint64_t mask = argc > 2 ? 0 : TRACE_ALL;
+
+        if (!on && strcmp(argv[1], "off")) {
+            cprintf("Usage: trace [on|off|clear|dump [n]|export] [event...]\n");
+            return 0;
+        }
+        for (int i = 2; i < argc; i++) {
+            int event = trace_event_parse(argv[i]);
+            if (event < 0) {
+                cprintf("trace: no event %s\n", argv[i]);
+                return 0;
+            }
+            mask |= 1ULL << event;
+        }
+
+        if (on)
+            trace_mask |= mask;
+        else
+            trace_mask &= ~mask;
+    }
+
+    uint64_t written, lost;
+    trace_stats(&written, &lost);
+
+    cprintf("trace:");
+    for (int i = 0; i < TRACE_NEVENTS; i++) {
+        if (trace_mask & (1ULL << i)) cprintf(" %s", trace_event_name(i));
+    }
+    cprintf("%s records=%lu lost=%lu\n", trace_mask ? "" : " off", (unsigned long)written, (unsigned long)lost);
+    return 0;
+}
+
 /* Kernel monitor command interpreter */
 
 static int
@@ -0,0 +1,231 @@
+/* Host tool: builds the asset pack linked into the kernel.
+ *
+ * Usage: packer -o <pack> [-b name=file] [-s name=file] ...
+ *   -b  raw blob, stored as one entry (e.g. packed font)
+ *   -s  sprite sheet in kern/raw_asset.bin format, one entry per frame
+ *
+ * Entries are RLE compressed when that makes them smaller. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <kern/assetpack.h>
+
+#define MAX_ENTRIES 256
+
+#define SHEET_MAGIC 0x0a0a0a0a0a0a0a0aULL
+
+struct sheet_header {
+    uint64_t magic;
+    uint16_t height;
+    uint16_t width;
+    uint32_t nframes;
+};
+
+static struct asset_pack_entry entries[MAX_ENTRIES];
+static uint8_t *entry_data[MAX_ENTRIES];
+static size_t nentries;
+
+static void
+usage(void) {
+    fprintf(stderr, "Usage: packer -o <pack> [-b name=file] [-s name=file] ...\n");
+    exit(2);
+}
+
+static void *
+read_file(const char *name, size_t *size) {
+    FILE *file = fopen(name, "rb");
+    if (!file) {
+        perror(name);
+        exit(1);
+    }
+
+    fseek(file, 0, SEEK_END);
+    *size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+
+    void *data = malloc(*size ? *size : 1);
+    if (!data || fread(data, 1, *size, file) != *size) {
+        fprintf(stderr, "%s: read failed\n", name);
+        exit(1);
+    }
+
+    fclose(file);
+    return data;
+}
+
+/* Returns compressed size, or 0 if it would not fit into limit */
+static size_t
+rle_compress(uint8_t *dst, size_t limit, const uint8_t *src, size_t size, unsigned unit) {
+    size_t n = size / unit, out = 0, i = 0;
+
+    while (i < n) {
+        size_t run = 1;
+        while (i + run < n && run < ASSET_RLE_MAX_LEN &&
+               !memcmp(src + (i + run) * unit, src + i * unit, unit)) {
+            run++;
+        }
+
+        if (run >= 2) {
+            if (out + 1 + unit > limit) return 0;
+            dst[out++] = ASSET_RLE_RUN | (run - 1);
+            memcpy(dst + out, src + i * unit, unit);
+            out += unit;
+            i += run;
+            continue;
+        }
+
+        /* literals until the next run of at least two */
+        size_t len = 1;
+        while (i + len < n && len < ASSET_RLE_MAX_LEN &&
+               (i + len + 1 >= n || memcmp(src + (i + len) * unit, src + (i + len + 1) * unit, unit))) {
+            len++;
+        }
+
+        if (out + 1 + len * unit > limit) return 0;
+        dst[out++] = len - 1;
+        memcpy(dst + out, src + i * unit, len * unit);
+        out += len * unit;
+        i += len;
+    }
+
+    return out;
+}
+
+static void
+add_entry(const char *name, uint32_t frame, uint16_t width, uint16_t height,
+          const uint8_t *data, size_t size, unsigned unit) {
+    if (nentries == MAX_ENTRIES) {
+        fprintf(stderr, "packer: too many entries\n");
+        exit(1);
+    }
+    if (strlen(name) >= ASSET_NAME_LEN) {
+        fprintf(stderr, "packer: name '%s' is too long\n", name);
+        exit(1);
+    }
+
+    struct asset_pack_entry *entry = &entries[nentries];
+    uint8_t *packed = malloc(size ? size : 1);
+    size_t packed_size = rle_compress(packed, size, data, size, unit);
+
+    strncpy(entry->name, name, ASSET_NAME_LEN);
+    entry->frame = frame;
+    entry->width = width;
+    entry->height = height;
+    entry->unit = unit;
+    entry->raw_size = size;
+
+    if (packed_size && packed_size < size) {
+        entry->compression = ASSET_COMP_RLE;
+        entry->size = packed_size;
+    } else {
+        entry->compression = ASSET_COMP_NONE;
+        entry->size = size;
+        memcpy(packed, data, size);
+    }
+
+    entry_data[nentries++] = packed;
+}
+
+static void
+add_blob(const char *name, const char *file) {
+    size_t size;
+    uint8_t *data = read_file(file, &size);
+
+    add_entry(name, 0, 0, 0, data, size, 1);
+    free(data);
+}
+
+static void
+add_sheet(const char *name, const char *file) {
+    size_t size;
+    uint8_t *data = read_file(file, &size);
+    struct sheet_header *header = (struct sheet_header *)data;
+
+    if (size < sizeof(*header) || header->magic != SHEET_MAGIC) {
+        fprintf(stderr, "%s: not a sprite sheet\n", file);
+        exit(1);
+    }
+
+    size_t frame_size = (size_t)header->width * header->height * sizeof(uint32_t);
+    if (sizeof(*header) + header->nframes * frame_size > size) {
+        fprintf(stderr, "%s: truncated sprite sheet\n", file);
+        exit(1);
+    }
+
+    for (uint32_t i = 0; i < header->nframes; i++) {
+        add_entry(name, i, header->width, header->height,
+                  data + sizeof(*header) + i * frame_size, frame_size, sizeof(uint32_t));
+    }
+    free(data);
+}
+
+int
+main(int argc, char **argv) {
+    const char *output = NULL;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "o:b:s:")) != -1) {
+        char *file = optarg ? strchr(optarg, '=') : NULL;
+
+        switch (opt) {
+        case 'o':
+            output = optarg;
+            break;
+        case 'b':
+        case 's':
+            if (!file) usage();
+            *file++ = 0;
+            if (opt == 'b') {
+                add_blob(optarg, file);
+            } else {
+                add_sheet(optarg, file);
+            }
+            break;
+        default:
+            usage();
+        }
+    }
+
+    if (!output || optind != argc) {
+        usage();
+    }
+
+    struct asset_pack_header header = {.magic = ASSET_PACK_MAGIC, .nentries = nentries};
+    size_t offset = sizeof(header) + nentries * sizeof(struct asset_pack_entry);
+    size_t raw_total = 0;
+
+    /* entries are 8-byte aligned, so uncompressed pixels can be used in place */
+    for (size_t i = 0; i < nentries; i++) {
+        offset = (offset + 7) & ~(size_t)7;
+        entries[i].offset = offset;
+        offset += entries[i].size;
+        raw_total += entries[i].raw_size;
+    }
+
+    FILE *out = fopen(output, "wb");
+    if (!out) {
+        perror(output);
+        return 1;
+    }
+
+    int ok = fwrite(&header, sizeof(header), 1, out) == 1 &&
+             fwrite(entries, sizeof(entries[0]), nentries, out) == nentries;
+    for (size_t i = 0; ok && i < nentries; i++) {
+        static const uint8_t zeros[8];
+        size_t pos = ftell(out);
+
+        ok = fwrite(zeros, 1, entries[i].offset - pos, out) == entries[i].offset - pos &&
+             fwrite(entry_data[i], 1, entries[i].size, out) == entries[i].size;
+    }
+
+    if (!ok || fclose(out)) {
+        fprintf(stderr, "%s: write failed\n", output);
+        return 1;
+    }
+
+    printf("packer: %zu entries, %zu -> %zu bytes\n", nentries, raw_total, offset);
+    return 0;
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * Pixel arithmetic helpers.
+ *
+ * Pixels use the surface layout (VIRTIO_GPU_FORMAT_X8R8G8B8_UNORM),
+ * which reads as 0xBBGGRRAA from a little-endian uint32_t.
+ * Blending works on premultiplied alpha, so the alpha byte also
+ * goes through the same per-channel math as the color bytes.
+ *
+ * SSE is disabled in the kernel (-mno-sse), so the "vector" code below
+ * is SWAR: 8-bit channels are spread into 16-bit lanes of a uint64_t
+ * and one integer multiply scales all of them at once.
+ */
+
+#define PIXEL_A(p) ((p)&0xFF)
+#define PIXEL_R(p) (((p) >> 8) & 0xFF)
+#define PIXEL_G(p) (((p) >> 16) & 0xFF)
+#define PIXEL_B(p) (((p) >> 24) & 0xFF)
+
+#define MAKE_ARGB(a, r, g, b) \
+    (((uint32_t)(b) << 24) | ((uint32_t)(g) << 16) | ((uint32_t)(r) << 8) | (uint32_t)(a))
+
+#define PIXEL_ALPHA_MASK 0x000000FFU
+
+#define PIXEL_LANES    0x00FF00FF00FF00FFULL
+#define PIXEL_ROUNDING 0x0080008000800080ULL
+
+/* Two adjacent pixels loaded with one access; backbuf is only 4-byte aligned */
+typedef uint64_t __attribute__((may_alias, aligned(4))) pixel2_t;
+
+/* (x * a) / 255 for every 16-bit lane of x, x lanes must be <= 255 */
+static inline uint64_t __attribute__((always_inline))
+lanes_scale(uint64_t x, uint32_t a) {
+    x = x * a + PIXEL_ROUNDING;
+    return ((x + ((x >> 8) & PIXEL_LANES)) >> 8) & PIXEL_LANES;
+}
+
+/* Multiply all four channels of a pixel by a / 255 */
+static inline uint32_t __attribute__((always_inline))
+pixel_scale(uint32_t p, uint32_t a) {
+    uint64_t x = (p & 0x00FF00FFU) | ((uint64_t)(p & 0xFF00FF00U) << 24);
+    x = lanes_scale(x, a);
+    return (uint32_t)(x | (x >> 24));
+}
+
+/* Same as pixel_scale() but for two packed pixels */
+static inline uint64_t __attribute__((always_inline))
+pixel_scale2(uint64_t pp, uint32_t a) {
+    return lanes_scale(pp & PIXEL_LANES, a) |
+           (lanes_scale((pp >> 8) & PIXEL_LANES, a) << 8);
+}
+
+/* Per channel a + (b - a) * w / 256, w is 0..256 */
+static inline uint32_t __attribute__((always_inline))
+pixel_lerp(uint32_t a, uint32_t b, uint32_t w) {
+    uint64_t xa = (a & 0x00FF00FFU) | ((uint64_t)(a & 0xFF00FF00U) << 24);
+    uint64_t xb = (b & 0x00FF00FFU) | ((uint64_t)(b & 0xFF00FF00U) << 24);
+    uint64_t x = ((xa * (256 - w) + xb * w) >> 8) & PIXEL_LANES;
+    return (uint32_t)(x | (x >> 24));
+}
+
+/* Turn opaque color into premultiplied pixel with given alpha */
+static inline uint32_t __attribute__((always_inline))
+pixel_premultiply(uint32_t color, uint32_t alpha) {
+    return pixel_scale(color | PIXEL_ALPHA_MASK, alpha);
+}
+
+/* Porter-Duff "over" for premultiplied src */
+static inline uint32_t __attribute__((always_inline))
+pixel_over(uint32_t dst, uint32_t src) {
+    return src + pixel_scale(dst, 255 - PIXEL_A(src));
+}
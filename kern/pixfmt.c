@@ -0,0 +1,170 @@
+/* Pixel format converters.
+ *
+ * 32-bit swizzles work on two pixels per 64-bit word (bswap or a
+ * rotate of both halves), SSE is not available in the kernel. */
+
+#include <inc/assert.h>
+#include <inc/string.h>
+
+#include "pixfmt.h"
+#include "pixel.h"
+#include "virtio-queue.h"
+
+/* Converted in chunks through a native buffer when neither side is native */
+#define PIXFMT_CHUNK 64
+
+static const struct {
+    const char *name;
+    size_t size;
+    uint32_t virtio_format;
+} formats[PIXFMT_COUNT] = {
+        [PIXFMT_X8R8G8B8] = {"X8R8G8B8", 4, VIRTIO_GPU_FORMAT_X8R8G8B8_UNORM},
+        [PIXFMT_B8G8R8A8] = {"B8G8R8A8", 4, VIRTIO_GPU_FORMAT_B8G8R8A8_UNORM},
+        [PIXFMT_R8G8B8A8] = {"R8G8B8A8", 4, VIRTIO_GPU_FORMAT_R8G8B8A8_UNORM},
+        [PIXFMT_RGB565] = {"RGB565", 2, 0},
+};
+
+size_t
+pixfmt_size(enum pixel_format format) {
+    return formats[format].size;
+}
+
+uint32_t
+pixfmt_virtio_format(enum pixel_format format) {
+    return formats[format].virtio_format;
+}
+
+const char *
+pixfmt_name(enum pixel_format format) {
+    return format < PIXFMT_COUNT ? formats[format].name : "unknown";
+}
+
+/* Native 0xBBGGRRXX <-> 0xXXRRGGBB, byte reversal of each half */
+static inline uint64_t
+swap_pair(uint64_t pp) {
+    pp = __builtin_bswap64(pp);
+    return (pp >> 32) | (pp << 32);
+}
+
+/* Native 0xBBGGRRXX -> 0xXXBBGGRR, rotate each half right by 8 */
+static inline uint64_t
+rotr8_pair(uint64_t pp) {
+    return ((pp >> 8) & 0x00FFFFFF00FFFFFFULL) | ((pp << 24) & 0xFF000000FF000000ULL);
+}
+
+/* 0xXXBBGGRR -> native, rotate each half left by 8 */
+static inline uint64_t
+rotl8_pair(uint64_t pp) {
+    return ((pp << 8) & 0xFFFFFF00FFFFFF00ULL) | ((pp >> 24) & 0x000000FF000000FFULL);
+}
+
+static inline uint16_t
+pack_565(uint32_t p) {
+    return ((PIXEL_R(p) >> 3) << 11) | ((PIXEL_G(p) >> 2) << 5) | (PIXEL_B(p) >> 3);
+}
+
+static inline uint32_t
+unpack_565(uint16_t c) {
+    /* replicate top bits so 0x1F expands to 0xFF */
+    uint32_t r = (c >> 11) & 0x1F, g = (c >> 5) & 0x3F, b = c & 0x1F;
+    return MAKE_ARGB(0xFF, (r << 3) | (r >> 2), (g << 2) | (g >> 4), (b << 3) | (b >> 2));
+}
+
+void
+pixfmt_from_native(void *dst, enum pixel_format format, const uint32_t *src, size_t n) {
+    pixel2_t *dst2 = dst;
+    const pixel2_t *src2 = (const pixel2_t *)src;
+    uint32_t *dst32 = dst;
+    size_t i = 0;
+
+    switch (format) {
+    case PIXFMT_X8R8G8B8:
+        memcpy(dst, src, n * sizeof(*src));
+        break;
+    case PIXFMT_B8G8R8A8:
+        /* host may use alpha, make it opaque */
+        for (; i + 2 <= n; i += 2) {
+            *dst2++ = swap_pair(*src2++) | 0xFF000000FF000000ULL;
+        }
+        if (i < n) {
+            dst32[i] = __builtin_bswap32(src[i]) | 0xFF000000U;
+        }
+        break;
+    case PIXFMT_R8G8B8A8:
+        for (; i + 2 <= n; i += 2) {
+            *dst2++ = rotr8_pair(*src2++) | 0xFF000000FF000000ULL;
+        }
+        if (i < n) {
+            dst32[i] = (uint32_t)rotr8_pair(src[i]) | 0xFF000000U;
+        }
+        break;
+    case PIXFMT_RGB565:
+        for (; i < n; i++) {
+            ((uint16_t *)dst)[i] = pack_565(src[i]);
+        }
+        break;
+    default:
+        panic("bad pixel format %d", format);
+    }
+}
+
+void
+pixfmt_to_native(uint32_t *dst, const void *src, enum pixel_format format, size_t n) {
+    pixel2_t *dst2 = (pixel2_t *)dst;
+    const pixel2_t *src2 = src;
+    const uint32_t *src32 = src;
+    size_t i = 0;
+
+    switch (format) {
+    case PIXFMT_X8R8G8B8:
+        memcpy(dst, src, n * sizeof(*dst));
+        break;
+    case PIXFMT_B8G8R8A8:
+        for (; i + 2 <= n; i += 2) {
+            *dst2++ = swap_pair(*src2++);
+        }
+        if (i < n) {
+            dst[i] = __builtin_bswap32(src32[i]);
+        }
+        break;
+    case PIXFMT_R8G8B8A8:
+        for (; i + 2 <= n; i += 2) {
+            *dst2++ = rotl8_pair(*src2++);
+        }
+        if (i < n) {
+            dst[i] = (uint32_t)rotl8_pair(src32[i]);
+        }
+        break;
+    case PIXFMT_RGB565:
+        for (; i < n; i++) {
+            dst[i] = unpack_565(((const uint16_t *)src)[i]);
+        }
+        break;
+    default:
+        panic("bad pixel format %d", format);
+    }
+}
+
+void
+pixfmt_convert(void *dst, enum pixel_format dst_format, const void *src, enum pixel_format src_format, size_t n) {
+    if (dst_format == PIXFMT_NATIVE) {
+        pixfmt_to_native(dst, src, src_format, n);
+        return;
+    }
+    if (src_format == PIXFMT_NATIVE) {
+        pixfmt_from_native(dst, dst_format, src, n);
+        return;
+    }
+
+    uint32_t chunk[PIXFMT_CHUNK];
+    while (n) {
+        size_t count = MIN(n, (size_t)PIXFMT_CHUNK);
+
+        pixfmt_to_native(chunk, src, src_format, count);
+        pixfmt_from_native(dst, dst_format, chunk, count);
+
+        src = (const char *)src + count * pixfmt_size(src_format);
+        dst = (char *)dst + count * pixfmt_size(dst_format);
+        n -= count;
+    }
+}
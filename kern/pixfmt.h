@@ -0,0 +1,36 @@
+#pragma once
+
+#include <inc/types.h>
+
+/**
+ * Pixel formats and row converters.
+ *
+ * Everything is drawn in PIXFMT_X8R8G8B8 (see pixel.h), other formats
+ * only exist at the edges: as the format of the host resource, converted
+ * at transfer time, or as compact storage for textures.
+ *
+ * Names follow virtio-gpu, i.e. the byte order in memory.
+ */
+
+enum pixel_format {
+    PIXFMT_X8R8G8B8, /* native, 0xBBGGRRXX as uint32_t */
+    PIXFMT_B8G8R8A8, /* 0xAARRGGBB */
+    PIXFMT_R8G8B8A8, /* 0xAABBGGRR */
+    PIXFMT_RGB565,   /* 16 bit, no virtio-gpu equivalent */
+    PIXFMT_COUNT,
+};
+
+#define PIXFMT_NATIVE PIXFMT_X8R8G8B8
+
+/* Bytes per pixel */
+size_t pixfmt_size(enum pixel_format format);
+
+/* VIRTIO_GPU_FORMAT_* for a host resource, 0 if the host can't use it */
+uint32_t pixfmt_virtio_format(enum pixel_format format);
+
+const char *pixfmt_name(enum pixel_format format);
+
+/* Convert n pixels, rows must not overlap */
+void pixfmt_from_native(void *dst, enum pixel_format format, const uint32_t *src, size_t n);
+void pixfmt_to_native(uint32_t *dst, const void *src, enum pixel_format format, size_t n);
+void pixfmt_convert(void *dst, enum pixel_format dst_format, const void *src, enum pixel_format src_format, size_t n);
@@ -9,7 +9,9 @@
 
 #include <kern/env.h>
 #include <kern/kclock.h>
+#include <kern/klog.h>
 #include <kern/pmap.h>
+#include <kern/trace.h>
 #include <kern/traceopt.h>
 #include <kern/trap.h>
 
@@ -38,10 +40,13 @@ struct AddressSpace *current_space;
 struct Page root;
 /* Top address for page pools mappings */
 static uintptr_t metaheaptop;
+/* PTE_NX if the CPU has it enabled */
+static pte_t pte_nx;
+/* Physical nodes of the filler pages for ALLOC_ZERO/ALLOC_ONE */
+static struct Page *zero_page, *one_page;
 
 /* Kernel executable end virtual address */
 extern char end[];
-extern char pfstacktop[], pfstack[];
 
 /* Those are internal flags for map_page function */
 #define ALLOC_POOL 0x10000
@@ -64,6 +69,26 @@ extern char pfstacktop[], pfstack[];
 
 #define ABSDIFF(x, y) ((x) > (y) ? (x) - (y) : (y) - (x))
 
+/* Classes of memory mapped by an entry of each page table level */
+#define PT_CLASS   0  /* 4K page */
+#define PD_CLASS   9  /* 2M page */
+#define PDP_CLASS  18 /* 1G page */
+#define PML4_CLASS 27
+
+#define PT_INDEX_CLASS(va, class) (((va) >> ((class) + CLASS_BASE)) & (PT_ENTRY_COUNT - 1))
+
+/* The mapping holds a reference to the physical page
+ * (set for allocated memory, not for MMIO and other physical ranges) */
+#define PTE_REF (1ULL << 52)
+/* Read-only until the first write, which gives the mapping
+ * a private copy of the page, see force_alloc_page() */
+#define PTE_LAZY (1ULL << 53)
+
+#define PTE_FLAGS(pte) ((pte) & ~PTE_ADDR(pte))
+
+/* Above this many pages unmap_region() reloads CR3 instead of invlpg */
+#define TLB_FLUSH_PAGES 32
+
 #define assert_physical(n) ({ if (trace_memory_more) _assert_root(__FILE__, __LINE__, n, 1); assert(((n)->state & NODE_TYPE_MASK) >= PARTIAL_NODE); })
 #define assert_virtual(n)  ({if (trace_memory_more) _assert_root(__FILE__, __LINE__, n, 0); assert(((n)->state & NODE_TYPE_MASK) < PARTIAL_NODE); })
 
@@ -85,6 +110,7 @@ list_append(struct List *list, struct List *new) {
     // LAB 6: Your code here
     new->next = list->next;
     new->prev = list;
+    list->next->prev = new;
     list->next = new;
 }
 
@@ -258,7 +284,7 @@ page_lookup(struct Page *hint, uintptr_t addr, int class, enum PageState type, b
         if (type != PARTIAL_NODE && node->state != RESERVED_NODE) node->state = type;
         if (node->state == ALLOCATABLE_NODE) list_append(&free_classes[node->class], (struct List *)node);
 
-        if (trace_memory) cprintf("Attaching page (%x) at %p class=%d\n", node->state, (void *)page2pa(node), (int)node->class);
+        if (trace_memory) klog(KLOG_DEBUG, "Attaching page (%x) at %p class=%d\n", node->state, (void *)page2pa(node), (int)node->class);
     }
 
     if (node) assert(!(page2pa(node) & CLASS_MASK(node->class)));
@@ -330,7 +356,7 @@ page_unref(struct Page *page) {
 static void
 attach_region(uintptr_t start, uintptr_t end, enum PageState type) {
     if (trace_memory_more)
-        cprintf("Attaching memory region [%08lX, %08lX] with type %d\n", start, end - 1, type);
+        klog(KLOG_DEBUG, "Attaching memory region [%08lX, %08lX] with type %d\n", start, end - 1, type);
     
     int class = 0, res = 0;
     (void)class;
@@ -458,6 +484,77 @@ check_virtual_tree(struct Page *page, int class) {
     }
 }
 
+/* Free memory, descriptor pools are counted too since they are never given back */
+static size_t
+free_memory(void) {
+    size_t size = 0;
+
+    for (int class = 0; class < MAX_CLASS; class++) {
+        for (struct List *n = free_classes[class].next; n != &free_classes[class]; n = n->next)
+            size += CLASS_SIZE(class);
+    }
+    for (struct PagePool *pool = first_pool; pool; pool = pool->next)
+        size += CLASS_SIZE(POOL_CLASS);
+    return size;
+}
+
+static pte_t *pt_lookup(struct AddressSpace *spc, uintptr_t va, int *class);
+
+/* Unused PML4 slot for check_lazy_alloc() */
+#define CHECK_VA (3ULL << PML4_SHIFT)
+
+/*
+ * Checks lazily committed memory through real write faults,
+ * so it must run after trap_init()
+ */
+void
+check_lazy_alloc(void) {
+    volatile uint8_t *one = (uint8_t *)CHECK_VA;
+    volatile uint8_t *zero = one + PAGE_SIZE;
+    volatile uint8_t *copy = one + 2 * PAGE_SIZE;
+    size_t free_before = free_memory();
+    size_t zero_refc = zero_page->refc, one_refc = one_page->refc;
+    pte_t *entry;
+    int class;
+
+    /* Filler pages are read through the shared page */
+    assert(!map_region(&kspace, CHECK_VA, NULL, 0, PAGE_SIZE, PROT_R | PROT_W | ALLOC_ONE));
+    assert(!map_region(&kspace, CHECK_VA + PAGE_SIZE, NULL, 0, PAGE_SIZE, PROT_R | PROT_W | ALLOC_ZERO));
+    assert(one[0] == 0xFF && one[PAGE_SIZE - 1] == 0xFF);
+    assert(zero[0] == 0x00 && zero[PAGE_SIZE - 1] == 0x00);
+
+    /* The first write gets a private page with the same contents */
+    one[0] = 0x12;
+    assert(one[0] == 0x12 && one[1] == 0xFF && one[PAGE_SIZE - 1] == 0xFF);
+    assert(one_page_raw[0] == 0xFF);
+    zero[0] = 0x34;
+    assert(zero[0] == 0x34 && zero[1] == 0x00);
+    assert(zero_page_raw[0] == 0x00);
+
+    /* Copy-on-write share, each side sees only its own writes */
+    assert(!map_region(&kspace, CHECK_VA + 2 * PAGE_SIZE, &kspace, CHECK_VA, PAGE_SIZE, PROT_R | PROT_W | PROT_LAZY));
+    assert((entry = pt_lookup(&kspace, CHECK_VA, &class)) && (*entry & PTE_LAZY));
+    physaddr_t shared = PTE_ADDR(*entry);
+    assert(copy[0] == 0x12);
+
+    copy[0] = 0x56;
+    assert(copy[0] == 0x56 && copy[1] == 0xFF && one[0] == 0x12);
+    assert((entry = pt_lookup(&kspace, (uintptr_t)copy, &class)) && PTE_ADDR(*entry) != shared);
+
+    /* The last mapping takes the page back without a copy */
+    one[0] = 0x78;
+    assert(one[0] == 0x78 && copy[0] == 0x56);
+    assert((entry = pt_lookup(&kspace, CHECK_VA, &class)) && PTE_ADDR(*entry) == shared);
+    assert((*entry & PTE_W) && !(*entry & PTE_LAZY));
+
+    unmap_region(&kspace, CHECK_VA, 3 * PAGE_SIZE);
+    assert(!pt_lookup(&kspace, CHECK_VA, &class) && class == PML4_CLASS);
+
+    assert(zero_page->refc == zero_refc && one_page->refc == one_refc);
+    assert(free_memory() == free_before);
+    check_physical_tree(&root);
+}
+
 /*
  * Pretty-print virtual memory tree
  */
@@ -530,8 +627,8 @@ found:
         newpool->next = first_pool;
         first_pool = newpool;
         free_desc_count += ndesc;
-        if (trace_memory_more) cprintf("Allocated pool of size %zu at [%08lX, %08lX]\n",
-                                       ndesc, page2pa(peer), page2pa(peer) + (long)CLASS_MASK(class));
+        if (trace_memory_more) klog(KLOG_DEBUG, "Allocated pool of size %zu at [%08lX, %08lX]\n",
+                                            ndesc, page2pa(peer), page2pa(peer) + (long)CLASS_MASK(class));
     }
 
     struct Page *new = page_lookup(peer, page2pa(peer), class, PARTIAL_NODE, 1);
@@ -543,17 +640,16 @@ found:
         first_pool->peer = new;
         allocating_pool = 0;
     } else {
-        if (trace_memory_more) cprintf("Allocated page at [%08lX, %08lX] class=%d\n",
-                                       page2pa(new), page2pa(new) + (long)CLASS_MASK(new->class), new->class);
+        if (trace_memory_more) klog(KLOG_DEBUG, "Allocated page at [%08lX, %08lX] class=%d\n",
+                                            page2pa(new), page2pa(new) + (long)CLASS_MASK(new->class), new->class);
     }
 
     assert(page2pa(new) >= PADDR(end) || page2pa(new) + CLASS_MASK(new->class) < IOPHYSMEM);
 
+    TRACE(PAGE_ALLOC, page2pa(new), new->class);
     return new;
 }
 
-static struct Page *zero_page, *one_page;
-
 /* Buffers for filler pages are statically allocated for simplicity
  * (this is also required for early KASAN) */
 __attribute__((aligned(HUGE_PAGE_SIZE))) uint8_t zero_page_raw[HUGE_PAGE_SIZE];
@@ -636,6 +732,8 @@ detect_memory(void) {
     check_physical_tree(&root);
 
     /* Setup constant one/zero pages */
+    memset(one_page_raw, 0xFF, sizeof(one_page_raw));
+
     one_page = page_lookup(NULL, PADDR(one_page_raw), MAX_ALLOCATION_CLASS, PARTIAL_NODE, 1);
     page_ref(one_page);
 
@@ -659,8 +757,8 @@ init_allocator(void) {
 
     /* Initialize first pool */
 
-    if (trace_memory_more) cprintf("First pool at [%08lX, %08lX]\n", PADDR(initial_buffer),
-                                   PADDR(initial_buffer) + INIT_DESCR * sizeof(struct Page));
+    if (trace_memory_more) klog(KLOG_DEBUG, "First pool at [%08lX, %08lX]\n", PADDR(initial_buffer),
+                                        PADDR(initial_buffer) + INIT_DESCR * sizeof(struct Page));
 
     list_init(&free_descriptors);
     free_desc_count = INIT_DESCR;
@@ -681,4 +779,355 @@ init_memory(void) {
     detect_memory();
     check_physical_tree(&root);
     if (trace_init) cprintf("Physical memory tree is correct\n");
+
+    /* Kernel address space is the boot page table for now */
+    kspace.cr3 = PTE_ADDR(rcr3());
+    kspace.pml4 = KADDR(kspace.cr3);
+    current_space = &kspace;
+
+    if (rdmsr(EFER_MSR) & EFER_NXE) pte_nx = PTE_NX;
+    /* Lazy mappings rely on writes to read-only pages faulting in the kernel too */
+    set_wp(1);
+}
+
+/*
+ * Page tables
+ *
+ * map_region() and unmap_region() edit the page tables of an address
+ * space directly. Each aligned chunk of a region is mapped with the
+ * largest page that fits it: 1G, 2M or 4K.
+ *
+ * ALLOC_ZERO/ALLOC_ONE memory is committed lazily: the region maps the
+ * shared zero_page/one_page read-only with PTE_LAZY, and the first write
+ * to a page faults into force_alloc_page(), which allocates a private
+ * page of the largest class up to MAX_ALLOCATION_CLASS that the mapping
+ * and the allocator allow. Shared mappings made with PROT_LAZY are
+ * copy-on-write the same way.
+ *
+ * Every mapping of allocated memory holds a reference to the physical
+ * page node of its class (PTE_REF). When a huge mapping is split to
+ * unmap a part of it, the reference moves from the huge node to its
+ * children; see frame_split().
+ */
+
+static pte_t
+prot_to_pte(int prot) {
+    pte_t pte = PTE_P | (prot & (PROT_W | PROT_CD | PROT_AVAIL));
+
+    if (prot & PROT_USER_) pte |= PTE_U;
+    if (!(prot & PROT_X)) pte |= pte_nx;
+    return pte;
+}
+
+static physaddr_t
+pt_alloc_table(void) {
+    struct Page *page = alloc_page(PT_CLASS, ALLOC_BOOTMEM);
+    if (!page) return 0;
+
+    page_ref(page);
+    memset(KADDR(page2pa(page)), 0, PAGE_SIZE);
+    return page2pa(page);
+}
+
+/* Tables from the boot page table aren't in the physical tree and stay */
+static bool
+pt_free_table(physaddr_t table) {
+    struct Page *page = page_lookup(NULL, table, PT_CLASS, PARTIAL_NODE, 0);
+    if (!page || page->state != ALLOCATABLE_NODE || !page->refc) return 0;
+
+    page_unref(page);
+    return 1;
+}
+
+static bool
+pt_table_empty(const pte_t *table) {
+    for (size_t i = 0; i < PT_ENTRY_COUNT; i++) {
+        if (table[i]) return 0;
+    }
+    return 1;
+}
+
+/* Moves the reference to the physical page of a huge mapping
+ * to its children of child_class */
+static void
+frame_split(physaddr_t pa, int class, int child_class) {
+    struct Page *parent = page_lookup(NULL, pa, class, PARTIAL_NODE, 0);
+    assert(parent && parent->refc);
+
+    /* new children are referenced on behalf of the parent */
+    for (size_t i = 0; i < PT_ENTRY_COUNT; i++) {
+        page_ref(page_lookup(parent, pa + i * CLASS_SIZE(child_class), child_class, PARTIAL_NODE, 1));
+    }
+    page_unref(parent);
+}
+
+/* Replaces the huge page entry mapping class with a table
+ * of smaller pages mapping the same memory */
+static int
+pt_split(pte_t *entry, uintptr_t va, int class) {
+    int child_class = class - PT_ENTRY_SHIFT;
+    pte_t old = *entry;
+
+    physaddr_t table = pt_alloc_table();
+    if (!table) return -E_NO_MEM;
+
+    /* PTE_PS is PAT in 4K entries */
+    pte_t flags = PTE_FLAGS(old) & ~(child_class == PT_CLASS ? PTE_PS : 0);
+    pte_t *child = KADDR(table);
+    for (size_t i = 0; i < PT_ENTRY_COUNT; i++) {
+        child[i] = (PTE_ADDR(old) + i * CLASS_SIZE(child_class)) | flags;
+    }
+
+    if (old & PTE_REF) frame_split(PTE_ADDR(old), class, child_class);
+
+    *entry = table | PTE_P | PTE_W | PTE_U;
+    invlpg((void *)va);
+    return 0;
+}
+
+/* Entry of the table level mapping class pages for va,
+ * missing tables are allocated and huge pages on the way split */
+static pte_t *
+pt_entry(struct AddressSpace *spc, uintptr_t va, int class) {
+    pte_t *table = spc->pml4;
+
+    for (int level = PML4_CLASS; level > class; level -= PT_ENTRY_SHIFT) {
+        pte_t *entry = &table[PT_INDEX_CLASS(va, level)];
+
+        if (!(*entry & PTE_P)) {
+            physaddr_t child = pt_alloc_table();
+            if (!child) return NULL;
+            *entry = child | PTE_P | PTE_W | PTE_U;
+        } else if (*entry & PTE_PS) {
+            if (pt_split(entry, va, level) < 0) return NULL;
+        }
+        table = KADDR(PTE_ADDR(*entry));
+    }
+
+    return &table[PT_INDEX_CLASS(va, class)];
+}
+
+/* Leaf entry mapping va and its class, NULL if va isn't mapped;
+ * then *class is the size of the hole */
+static pte_t *
+pt_lookup(struct AddressSpace *spc, uintptr_t va, int *class) {
+    pte_t *table = spc->pml4;
+
+    for (int level = PML4_CLASS;; level -= PT_ENTRY_SHIFT) {
+        pte_t *entry = &table[PT_INDEX_CLASS(va, level)];
+
+        *class = level;
+        if (!(*entry & PTE_P)) return NULL;
+        if (level == PT_CLASS || (*entry & PTE_PS)) return entry;
+        table = KADDR(PTE_ADDR(*entry));
+    }
+}
+
+/* Unmaps [start, end) from the table at level class based at va base,
+ * counting unmapped pages in *unmapped */
+static void
+pt_unmap(pte_t *table, int class, uintptr_t base, uintptr_t start, uintptr_t end, size_t *unmapped) {
+    for (size_t i = PT_INDEX_CLASS(start, class); i < PT_ENTRY_COUNT; i++) {
+        uintptr_t va = base + i * CLASS_SIZE(class);
+        if (va >= end) break;
+
+        pte_t *entry = &table[i];
+        if (!(*entry & PTE_P)) continue;
+
+        uintptr_t from = MAX(start, va), to = MIN(end, va + CLASS_SIZE(class));
+        bool whole = from == va && to == va + CLASS_SIZE(class);
+
+        if (class == PT_CLASS || (*entry & PTE_PS)) {
+            if (whole) {
+                if (*entry & PTE_REF) {
+                    page_unref(page_lookup(NULL, PTE_ADDR(*entry), class, PARTIAL_NODE, 0));
+                }
+                *entry = 0;
+                if ((*unmapped)++ < TLB_FLUSH_PAGES) invlpg((void *)va);
+                continue;
+            }
+            if (pt_split(entry, va, class) < 0) panic("Out of memory\n");
+        }
+
+        pte_t *child = KADDR(PTE_ADDR(*entry));
+        pt_unmap(child, class - PT_ENTRY_SHIFT, va, from, to, unmapped);
+        if (pt_table_empty(child) && pt_free_table(PTE_ADDR(*entry))) *entry = 0;
+    }
+}
+
+void
+unmap_region(struct AddressSpace *dspace, uintptr_t dst, uintptr_t size) {
+    assert(!(dst & CLASS_MASK(0)) && !(size & CLASS_MASK(0)));
+    if (!size) return;
+
+    size_t unmapped = 0;
+    pt_unmap(dspace->pml4, PML4_CLASS, 0, dst, dst + size, &unmapped);
+
+    if (unmapped > TLB_FLUSH_PAGES && dspace->cr3 == PTE_ADDR(rcr3())) tlbflush();
+}
+
+/* Largest page class that maps va to pa and fits into size */
+static int
+map_class(uintptr_t va, physaddr_t pa, uintptr_t size, int maxclass) {
+    for (int class = PDP_CLASS; class > PT_CLASS; class -= PT_ENTRY_SHIFT) {
+        if (class <= maxclass && !((va | pa) & CLASS_MASK(class)) && size >= CLASS_SIZE(class)) return class;
+    }
+    return PT_CLASS;
+}
+
+/*
+ * Maps [dst, dst + size) in dspace, replacing what was mapped there.
+ * The memory is
+ *   - zeroed/0xFF filled memory with ALLOC_ZERO/ALLOC_ONE, committed on write,
+ *   - memory mapped at src in sspace, shared, or copy-on-write for
+ *     both spaces with PROT_LAZY,
+ *   - physical memory at src if sspace is NULL.
+ * flags are PROT_* for the new mapping.
+ */
+int
+map_region(struct AddressSpace *dspace, uintptr_t dst, struct AddressSpace *sspace, uintptr_t src, uintptr_t size, int flags) {
+    if ((dst | src | size) & CLASS_MASK(0)) return -E_INVAL;
+
+    unmap_region(dspace, dst, size);
+
+    bool fill = flags & (ALLOC_ZERO | ALLOC_ONE);
+    pte_t prot = prot_to_pte(flags);
+    uintptr_t va = dst, end = dst + size;
+    int res = 0;
+
+    while (va < end) {
+        physaddr_t pa;
+        int maxclass = PDP_CLASS;
+        bool ref = 0, lazy = 0;
+
+        if (fill) {
+            /* any part of the filler page will do */
+            pa = PADDR(flags & ALLOC_ONE ? one_page_raw : zero_page_raw) + (va & (HUGE_PAGE_SIZE - 1));
+            maxclass = PD_CLASS;
+            lazy = flags & PROT_W;
+        } else if (sspace) {
+            uintptr_t sva = src + (va - dst);
+            int sclass;
+            pte_t *sentry = pt_lookup(sspace, sva, &sclass);
+            if (!sentry) {
+                res = -E_FAULT;
+                break;
+            }
+
+            if ((flags & PROT_LAZY) && (*sentry & PTE_W)) {
+                *sentry = (*sentry & ~PTE_W) | PTE_LAZY;
+                if (sspace->cr3 == PTE_ADDR(rcr3())) invlpg((void *)sva);
+            }
+
+            pa = PTE_ADDR(*sentry) + (sva & CLASS_MASK(sclass));
+            maxclass = sclass;
+            ref = *sentry & PTE_REF;
+            lazy = (flags & PROT_W) && ((flags & PROT_LAZY) || (*sentry & PTE_LAZY));
+        } else {
+            pa = src + (va - dst);
+        }
+
+        int class = map_class(va, pa, end - va, maxclass);
+        pte_t *entry;
+
+        /* a table left by someone else, map smaller pages into it */
+        while ((entry = pt_entry(dspace, va, class)) && (*entry & PTE_P)) {
+            assert(class > PT_CLASS && !(*entry & PTE_PS));
+            class -= PT_ENTRY_SHIFT;
+        }
+
+        struct Page *page = entry && ref ? page_lookup(NULL, pa, class, PARTIAL_NODE, 1) : NULL;
+        if (!entry || (ref && !page)) {
+            res = -E_NO_MEM;
+            break;
+        }
+        if (ref) page_ref(page);
+
+        *entry = pa | (lazy ? (prot & ~PTE_W) | PTE_LAZY : prot) |
+                 (class != PT_CLASS ? PTE_PS : 0) | (ref ? PTE_REF : 0);
+        va += CLASS_SIZE(class);
+    }
+
+    if (res < 0) unmap_region(dspace, dst, va - dst);
+    return res;
+}
+
+/* Nobody else maps the page, directly or through a bigger page */
+static bool
+frame_unique(struct Page *page) {
+    if (!PAGE_IS_UNIQ(page)) return 0;
+
+    for (struct Page *par = page->parent; par; par = par->parent) {
+        if (par->refc) return 0;
+    }
+    return 1;
+}
+
+/*
+ * Gives the lazy mapping of va a private writable page
+ * of at most maxclass, filled from what it mapped before.
+ * Returns -E_FAULT if va isn't mapped lazily.
+ */
+int
+force_alloc_page(struct AddressSpace *spc, uintptr_t va, int maxclass) {
+    struct Page *page = NULL;
+    pte_t *entry;
+    int class;
+
+    for (;;) {
+        entry = pt_lookup(spc, va, &class);
+        if (!entry || !(*entry & PTE_LAZY)) return -E_FAULT;
+
+        if (class <= maxclass) {
+            /* the last copy-on-write mapping takes the page back */
+            if (*entry & PTE_REF) {
+                struct Page *old = page_lookup(NULL, PTE_ADDR(*entry), class, PARTIAL_NODE, 0);
+                if (old && frame_unique(old)) break;
+            }
+
+            page = alloc_page(class, ALLOC_BOOTMEM);
+            if (page) break;
+            if (class == PT_CLASS) return -E_NO_MEM;
+        }
+
+        if (pt_split(entry, va, class) < 0) return -E_NO_MEM;
+    }
+
+    pte_t old = *entry;
+    uintptr_t base = ROUNDDOWN(va, CLASS_SIZE(class));
+
+    if (page) {
+        physaddr_t from = PTE_ADDR(old);
+        void *to = KADDR(page2pa(page));
+
+        if (from - PADDR(zero_page_raw) < HUGE_PAGE_SIZE) {
+            memset(to, 0x00, CLASS_SIZE(class));
+        } else if (from - PADDR(one_page_raw) < HUGE_PAGE_SIZE) {
+            memset(to, 0xFF, CLASS_SIZE(class));
+        } else {
+            memcpy(to, KADDR(from), CLASS_SIZE(class));
+        }
+
+        page_ref(page);
+        *entry = page2pa(page) | (PTE_FLAGS(old) & ~PTE_LAZY) | PTE_W | PTE_REF;
+        if (old & PTE_REF) page_unref(page_lookup(NULL, PTE_ADDR(old), class, PARTIAL_NODE, 0));
+    } else {
+        *entry = (old & ~PTE_LAZY) | PTE_W;
+    }
+
+    if (spc->cr3 == PTE_ADDR(rcr3())) invlpg((void *)base);
+    return 0;
+}
+
+/* Zeroed kernel memory in the kernel heap, big regions get huge pages */
+void *
+kzalloc_region(size_t size) {
+    size = ROUNDUP(size, PAGE_SIZE);
+    uintptr_t va = ROUNDUP(metaheaptop, size >= HUGE_PAGE_SIZE ? HUGE_PAGE_SIZE : PAGE_SIZE);
+
+    if (va + size > KERN_HEAP_END) panic("Out of kernel heap\n");
+    if (map_region(&kspace, va, NULL, 0, size, PROT_R | PROT_W | ALLOC_ZERO) < 0) panic("Out of memory\n");
+
+    metaheaptop = va + size;
+    return (void *)va;
 }
@@ -105,6 +105,7 @@ struct PagePool {
 int map_region(struct AddressSpace *dspace, uintptr_t dst, struct AddressSpace *sspace, uintptr_t src, uintptr_t size, int flags);
 void unmap_region(struct AddressSpace *dspace, uintptr_t dst, uintptr_t size);
 void init_memory(void);
+void check_lazy_alloc(void);
 void release_address_space(struct AddressSpace *space);
 struct AddressSpace *switch_address_space(struct AddressSpace *space);
 int init_address_space(struct AddressSpace *space);
@@ -124,6 +125,8 @@ extern struct AddressSpace kspace;
 extern struct AddressSpace *current_space;
 extern struct Page root;
 extern char bootstacktop[], bootstack[];
+extern char pfstacktop[], pfstack[];
+extern char dfstacktop[], dfstack[];
 extern size_t max_memory_map_addr;
 
 /* This macro takes a kernel virtual address -- an address that points above
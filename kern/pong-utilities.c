@@ -1,13 +1,11 @@
 #include "pong-utilities.h"
 #include "console.h"
 
-static int64_t delay = 1000 * 1000;
+#include <inc/kbdreg.h>
+
 static int default_segment_width = 5;
 static int default_segment_height = 35;
 
-extern char __assets_start[];
-extern char __assets_end[];
-
 static char digit_bitmap[] = {
         0b11111010, // 0
         0b10100000, // 1
@@ -21,58 +19,39 @@ static char digit_bitmap[] = {
         0b10111110, // 9
 };
 
-typedef struct asset_header {
-    uint64_t magic;
-    uint16_t height;
-    uint16_t width;
-    uint32_t nframes;
-} asset_header_t;
-
 
-static enum Key
-get_keyboard_key() {
-    int key = cons_getc();
+// Space quits, otherwise the paddle follows the arrows held down
+enum Input
+get_keyboard_input(void) {
+    struct key_event event;
+    bool quit = false;
 
-    if (key == 0)
-        return KEY_EMPTY;
-
-    if (key == KEY_ESC) {
-        key = cons_getc();
-        if (key >= KEY_UP && key <= KEY_LEFT) {
-            return key;
+    key_poll();
+    while (key_event_pop(&event)) {
+        if (event.key == ' ' && (event.flags & KEY_EVENT_DOWN)) {
+            quit = true;
         }
-    } else if (key == KEY_SPACE) {
-        return key;
     }
-    return KEY_UNKNOWN;
-}
-
-enum Key
-get_last_keyboard_key(void) {
-    enum Key keyboard_key = KEY_UNKNOWN;
-    enum Key temp_key = get_keyboard_key();
 
-    while (temp_key != KEY_EMPTY) {
-        keyboard_key = temp_key;
-        temp_key = get_keyboard_key();
+    if (quit) {
+        return INPUT_QUIT;
     }
-    return keyboard_key;
+    if (key_pressed(KEY_UP) != key_pressed(KEY_DN)) {
+        return key_pressed(KEY_UP) ? INPUT_UP : INPUT_DOWN;
+    }
+    return INPUT_STOP;
 }
 
+// Drops input typed before or during the game, so it doesn't reach the monitor
 void
-game_delay(int32_t game_ticks) {
-    game_ticks += 15 * delay;
-
-    int64_t sleep_time = (game_ticks - (int64_t)current_ms()) / delay;
-
-    if (sleep_time >= 0) {
-        sleep(sleep_time);
+flush_keyboard(void) {
+    while (cons_getc()) {
     }
+    key_event_flush();
 }
 
-
 void
-draw_number(struct surface_t *screen, uint64_t x, uint64_t y, int n) {
+draw_number(struct display_list *dl, uint64_t x, uint64_t y, int n) {
     if (sizeof(digit_bitmap) < n) {
         return;
     }
@@ -82,7 +61,7 @@ draw_number(struct surface_t *screen, uint64_t x, uint64_t y, int n) {
 
     for (int i = 1; i < 4; ++i) {
         if ((nseg >> i) & 1) {
-            surface_fill_rect(screen, &segment, TEST_XRGB_WHITE);
+            dl_fill_rect(dl, &segment, TEST_XRGB_WHITE);
         }
         segment.y += default_segment_height;
     }
@@ -96,37 +75,33 @@ draw_number(struct surface_t *screen, uint64_t x, uint64_t y, int n) {
         segment.y = y + (i / 6) * default_segment_height;
         segment.y += padding;
         if ((nseg >> i) & 1) {
-            surface_fill_rect(screen, &segment, TEST_XRGB_WHITE);
+            dl_fill_rect(dl, &segment, TEST_XRGB_WHITE);
         }
     }
 }
 
 
-static uint32_t *
-get_splash_animation(uint16_t *width, uint16_t *height) {
-    asset_header_t *splash_hdr = (asset_header_t *)__assets_start;
-    *width = splash_hdr->width;
-    *height = splash_hdr->height;
-    return (uint32_t *)(__assets_start + sizeof(asset_header_t));
-}
-
 uint32_t
 get_splash_animation_frames() {
-    asset_header_t *splash_hdr = (asset_header_t *)__assets_start;
-    return splash_hdr->nframes;
+    return get_main_atlas()->nsprites;
 }
 
 
 void
-draw_splash_frame(struct surface_t *screen, uint32_t x, uint32_t y, uint32_t nframe, int mirrored, uint32_t extra_color) {
-    uint16_t height = 0, width = 0;
-    uint32_t *texture = get_splash_animation(&width, &height);
-    rect_t texture_rect = {.x = x,
-                           .y = y - height / 2,
-                           .height = height,
-                           .width = width};
+draw_splash_frame(struct display_list *dl, uint32_t x, uint32_t y, uint32_t nframe, int mirrored, uint32_t extra_color) {
+    // recorded by pointer, has to live until the frame is rendered
+    static struct sprite_draw splash;
+    struct sprite_atlas *atlas = get_main_atlas();
+    const struct sprite *frame = &atlas->sprites[nframe];
+
+    splash = (struct sprite_draw){
+            .sprite = nframe,
+            .x = x,
+            .y = y - frame->height / 2,
+            .flags = mirrored ? SPRITE_MIRROR : SPRITE_TINT,
+            .color = extra_color};
     if (mirrored) {
-        texture_rect.x -= width;
+        splash.x -= frame->width;
     }
-    surface_fill_texture(screen, &texture_rect, texture + height * width * nframe, mirrored, extra_color);
+    dl_draw_sprites(dl, atlas, &splash, 1);
 }
@@ -2,16 +2,15 @@
 
 #include <inc/x86.h>
 #include "graphic.h"
+#include "displaylist.h"
 
-enum Key {
-    KEY_EMPTY,
-    KEY_UNKNOWN,
-    KEY_ESC = '[',
-    KEY_UP = 'A',
-    KEY_DOWN,
-    KEY_RIGHT,
-    KEY_LEFT,
-    KEY_SPACE = ' ',
+// What the player asks for, recorded by replay.c
+enum Input {
+    INPUT_NONE,
+    INPUT_STOP,
+    INPUT_UP,
+    INPUT_DOWN,
+    INPUT_QUIT,
 };
 
 enum State {
@@ -21,8 +20,8 @@ enum State {
     USER_WIN,
 };
 
-enum Key get_last_keyboard_key(void);
-void game_delay(int32_t game_ticks);
-void draw_number(struct surface_t *screen, uint64_t x, uint64_t y, int n);
-void draw_splash_frame(struct surface_t *screen, uint32_t x, uint32_t y, uint32_t nframe, int mirrored, uint32_t extra_color);
+enum Input get_keyboard_input(void);
+void flush_keyboard(void);
+void draw_number(struct display_list *dl, uint64_t x, uint64_t y, int n);
+void draw_splash_frame(struct display_list *dl, uint32_t x, uint32_t y, uint32_t nframe, int mirrored, uint32_t extra_color);
 uint32_t get_splash_animation_frames();
\ No newline at end of file
@@ -2,49 +2,51 @@
 #include "pong.h"
 #include "pong-utilities.h"
 #include "graphic.h"
+#include "pixel.h"
+#include "text.h"
+#include "displaylist.h"
+#include "framesched.h"
+#include "profiler.h"
+#include "replay.h"
 #include <inc/stdio.h>
+#include <inc/string.h>
 
 static int max_score = 9;
 static int paddle_width = 11;
 static int paddle_height = 50;
 static int paddle_padding = 30;
 static int net_offset = 30;
+static int net_segments = 15;
 static int ball_size = 10;
 static int player_paddle_speed = 10;
 static int ai_paddle_speed = 5;
 static int frame_width = 2;
+static uint8_t game_over_dim = 0x60;
+static uint32_t sim_tick_hz = 60;
+static uint32_t frame_hz = 60;
+static uint32_t hud_padding = 8;
+static int stress_max_speed = 4;
+
+#define ENTITY_MAX 4096
+
+/* Fixed entity indices, the net segments follow the gates and balls go last */
+enum {
+    ENT_PADDLE_AI,
+    ENT_PADDLE_USER,
+    ENT_GATE_LEFT,
+    ENT_GATE_RIGHT,
+    ENT_NET,
+};
 
-struct game_data;
-
-typedef void (*draw_func)(void *, struct surface_t *);
-typedef void (*move_func)(struct game_data *);
+#define PADDLE_COUNT 2
 
 
 enum EffectType {
     SPLASH,
 };
 
-typedef struct rectangle {
-    int x, y;
-    int w, h;
-    uint32_t color;
-    draw_func draw;
-    move_func move;
-} rectangle_t;
-
-typedef struct paddle {
-    rectangle_t rect;
-    int v_y;
-} paddle_t;
-
-typedef struct ball {
-    rectangle_t rect;
-    int v_x, v_y;
-} ball_t;
-
-
 typedef struct effect {
-    rectangle_t *traced_rect;
+    uint32_t traced; /* entity */
     enum EffectType type;
     int x_offset;
     int y_offset;
@@ -55,70 +57,88 @@ typedef struct effect {
 } effect_t;
 
 
+/* All game objects, one array per field so systems loop over contiguous data */
+static struct entities {
+    uint32_t count;
+    uint32_t first_ball; /* the game ball, the rest are stress balls */
+
+    int32_t x[ENTITY_MAX];
+    int32_t y[ENTITY_MAX];
+    int32_t prev_x[ENTITY_MAX]; /* position before the last simulation tick */
+    int32_t prev_y[ENTITY_MAX];
+    int32_t v_x[ENTITY_MAX];
+    int32_t v_y[ENTITY_MAX];
+    int32_t w[ENTITY_MAX];
+    int32_t h[ENTITY_MAX];
+    uint32_t color[ENTITY_MAX];
+
+    /* interpolated rects, filled by the draw pass */
+    rect_t rects[ENTITY_MAX];
+} ents;
+
 static struct game_data {
-    ball_t ball;
-    paddle_t paddle[2];
-    rectangle_t net;
-    rectangle_t gates[2];
     effect_t splash;
-    rectangle_t *objects[8];
-    int ndrawable;
-    int nmovable;
+    uint32_t stress_balls;
     int ai_score;
     int user_score;
     struct surface_t screen;
+    struct display_list dl;
+    uint32_t alpha; /* render interpolation, see frame_sched_alpha() */
 } game_info;
 
 
-#define RECT2GPU_RECT(game_rect_name, gpu_rect_name)   \
-    rectangle_t *rect = (rectangle_t *)game_rect_name; \
-    struct virtio_gpu_rect gpu_rect_name = {.height = rect->h, .width = rect->w, .x = rect->x, .y = rect->y};
-
-static void
-draw_ball(void *ball_rect, struct surface_t *screen) {
-    RECT2GPU_RECT(ball_rect, ball);
-    surface_fill_rect(screen, &ball, rect->color);
+static inline int
+interpolate(int prev, int cur) {
+    return prev + (cur - prev) * (int)game_info.alpha / FRAME_ALPHA_ONE;
 }
 
-static void
-draw_paddle(void *paddle_rect, struct surface_t *screen) {
-    RECT2GPU_RECT(paddle_rect, paddle);
-    surface_fill_rect(screen, &paddle, rect->color);
-    surface_draw_circle(screen, paddle.x + (paddle.width -1) / 2, paddle.y, paddle.width / 2, rect->color);
-    surface_draw_circle(screen, paddle.x + (paddle.width -1) / 2, paddle.y + paddle.height, paddle.width / 2, rect->color);
+static int
+entity_add(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) {
+    if (ents.count == ENTITY_MAX) {
+        return -1;
+    }
 
+    uint32_t i = ents.count++;
+    ents.x[i] = ents.prev_x[i] = x;
+    ents.y[i] = ents.prev_y[i] = y;
+    ents.v_x[i] = ents.v_y[i] = 0;
+    ents.w[i] = w;
+    ents.h[i] = h;
+    ents.color[i] = color;
+    return i;
 }
 
 static void
-draw_net(void *net_rect, struct surface_t *screen) {
-    RECT2GPU_RECT(net_rect, net);
-
-    for (int i = 0; i < screen->height / (net.height + net_offset) * 1.5; i++) {
-        surface_fill_rect(screen, &net, rect->color);
-        net.y += net_offset;
+draw_effect(effect_t *e, struct display_list *dl) {
+    if (!e->enable) {
+        return;
     }
-}
+    uint32_t i = e->traced;
+    int x = interpolate(ents.prev_x[i], ents.x[i]);
+    if (!e->y_mirror) {
+        x += ents.w[i];
+    }
+    int y = interpolate(ents.prev_y[i], ents.y[i]) - e->y_offset;
 
-static void
-draw_gate(void *gate_rect, struct surface_t *screen) {
-    RECT2GPU_RECT(gate_rect, gate);
-    surface_fill_rect(screen, &gate, rect->color);
+    switch (e->type) {
+    case SPLASH:
+        draw_splash_frame(dl, x, y, e->frame, e->y_mirror, e->extra_color);
+        break;
+
+    default:
+        break;
+    }
 }
 
+/* Effects are animated per simulation tick, so replays see the same frames */
 static void
-draw_effect(effect_t *e, struct surface_t *screen) {
+effect_tick(effect_t *e) {
     if (!e->enable) {
         return;
     }
-    int x = e->traced_rect->x;
-    if (!e->y_mirror) {
-        x += e->traced_rect->w;
-    }
-    int y = e->traced_rect->y - e->y_offset;
 
     switch (e->type) {
     case SPLASH:
-        draw_splash_frame(screen, x, y, e->frame, e->y_mirror, e->extra_color);
         e->frame += 1;
         if (e->frame == get_splash_animation_frames()) {
             e->frame = 0;
@@ -132,153 +152,192 @@ draw_effect(effect_t *e, struct surface_t *screen) {
 }
 
 static void
-effect_attach(effect_t *e, rectangle_t *rect, int mirrored, int x_offset, int y_offset, uint32_t color) {
+effect_attach(effect_t *e, uint32_t entity, int mirrored, int x_offset, int y_offset, uint32_t color) {
     e->enable = 1;
-    e->traced_rect = rect;
+    e->traced = entity;
     e->y_mirror = mirrored;
     e->x_offset = x_offset;
     e->y_offset = y_offset;
     e->extra_color = color;
 }
 
-
+/* Single draw pass over all entities */
 static void
-move_dummy(paddle_t *paddle_array, ball_t *ball, struct surface_t *screen) {
+draw_entities(struct display_list *dl) {
+    for (uint32_t i = 0; i < ents.count; i++) {
+        ents.rects[i] = (rect_t){interpolate(ents.prev_x[i], ents.x[i]), interpolate(ents.prev_y[i], ents.y[i]),
+                                 ents.w[i], ents.h[i]};
+    }
+
+    // paddles have round ends
+    for (uint32_t i = 0; i < PADDLE_COUNT; i++) {
+        rect_t *paddle = &ents.rects[i];
+        dl_fill_rect(dl, paddle, ents.color[i]);
+        dl_draw_circle(dl, paddle->x + (paddle->width - 1) / 2, paddle->y, paddle->width / 2, ents.color[i]);
+        dl_draw_circle(dl, paddle->x + (paddle->width - 1) / 2, paddle->y + paddle->height, paddle->width / 2, ents.color[i]);
+    }
+
+    // everything else is a plain rect
+    dl_fill_rects(dl, &ents.rects[PADDLE_COUNT], &ents.color[PADDLE_COUNT], ents.count - PADDLE_COUNT);
 }
 
+static void
+save_positions(void) {
+    memcpy(ents.prev_x, ents.x, ents.count * sizeof(*ents.x));
+    memcpy(ents.prev_y, ents.y, ents.count * sizeof(*ents.y));
+}
 
 static void
-move_paddle(struct game_data *data) {
-    paddle_t *paddle = data->paddle + 1;
-    paddle->rect.y += paddle->v_y;
-    if (paddle->rect.y >= data->screen.height - paddle->rect.h) {
-        paddle->rect.y = data->screen.height - paddle->rect.h;
+clamp_paddle(uint32_t i) {
+    if (ents.y[i] >= (int32_t)game_info.screen.height - ents.h[i]) {
+        ents.y[i] = game_info.screen.height - ents.h[i];
     }
-    if (paddle->rect.y <= 0) {
-        paddle->rect.y = 0;
+    if (ents.y[i] <= 0) {
+        ents.y[i] = 0;
     }
 }
 
 static void
-move_paddle_ai(struct game_data *data) {
-    paddle_t *paddle = data->paddle;
-    struct surface_t *screen = &data->screen;
-    ball_t *ball = &data->ball;
-    int center = paddle->rect.y + paddle_height / 2;
+move_paddle(void) {
+    ents.y[ENT_PADDLE_USER] += ents.v_y[ENT_PADDLE_USER];
+    clamp_paddle(ENT_PADDLE_USER);
+}
+
+/* follows the game ball */
+static void
+move_paddle_ai(void) {
+    uint32_t paddle = ENT_PADDLE_AI, ball = ents.first_ball;
+    struct surface_t *screen = &game_info.screen;
+    int center = ents.y[paddle] + paddle_height / 2;
     int screen_center = screen->height / 2 - paddle_height / 2;
-    int ball_speed = ball->v_y > 0 ? ball->v_y : -ball->v_y;
+    int ball_speed = ents.v_y[ball] > 0 ? ents.v_y[ball] : -ents.v_y[ball];
 
-    if (ball->v_x > 0) {
+    if (ents.v_x[ball] > 0) {
         // return to center position
         if (center < screen_center - paddle_height / 2) {
-            paddle->rect.y += ball_speed;
+            ents.y[paddle] += ball_speed;
         } else if (center > screen_center + paddle_height / 2) {
-            paddle->rect.y -= ball_speed;
+            ents.y[paddle] -= ball_speed;
         }
     } else {
         // ball moving down
-        if (ball->v_y > 0) {
-            if (ball->rect.y > center) {
-                paddle->rect.y += ball_speed;
+        if (ents.v_y[ball] > 0) {
+            if (ents.y[ball] > center) {
+                ents.y[paddle] += ball_speed;
             } else {
-                paddle->rect.y -= ball_speed;
+                ents.y[paddle] -= ball_speed;
             }
         }
         // ball moving up
-        if (ball->v_y < 0) {
-            if (ball->rect.y < center) {
-                paddle->rect.y -= ball_speed;
+        if (ents.v_y[ball] < 0) {
+            if (ents.y[ball] < center) {
+                ents.y[paddle] -= ball_speed;
             } else {
-                paddle->rect.y += ball_speed;
+                ents.y[paddle] += ball_speed;
             }
         }
         // ball moving stright across
-        if (ball->v_y == 0) {
-            if (ball->rect.y < center - paddle_height / 2) {
-                paddle->rect.y -= paddle->v_y;
-            } else if (ball->rect.y > center + paddle_height / 2) {
-                paddle->rect.y += paddle->v_y;
+        if (ents.v_y[ball] == 0) {
+            if (ents.y[ball] < center - paddle_height / 2) {
+                ents.y[paddle] -= ents.v_y[paddle];
+            } else if (ents.y[ball] > center + paddle_height / 2) {
+                ents.y[paddle] += ents.v_y[paddle];
             }
         }
     }
-    if (paddle->rect.y <= 0) {
-        paddle->rect.y = 0;
-    } else if (paddle->rect.y >= screen->height - paddle->rect.h) {
-        paddle->rect.y = screen->height - paddle->rect.h;
-    }
+    clamp_paddle(paddle);
 }
 
-// if return value is 1 collision occured. if return is 0, no collision.
-static int
-check_collision(ball_t *ball, paddle_t *paddle) {
-    if (ball->rect.x > paddle->rect.x + paddle->rect.w) {
-        return 0;
-    }
-    if (ball->rect.x + ball->rect.w < paddle->rect.x) {
-        return 0;
-    }
-    if (ball->rect.y > paddle->rect.y + paddle->rect.h) {
-        return 0;
+static void
+move_balls(void) {
+    int32_t height = game_info.screen.height;
+    int32_t width = game_info.screen.width;
+
+    for (uint32_t i = ents.first_ball; i < ents.count; i++) {
+        ents.x[i] += ents.v_x[i];
+        ents.y[i] += ents.v_y[i];
+
+        if (ents.y[i] < 0 || ents.y[i] > height - ents.h[i]) {
+            ents.v_y[i] = -ents.v_y[i];
+        }
     }
-    if (ball->rect.y + ball->rect.h < paddle->rect.y) {
-        return 0;
+
+    // stress balls bounce off the gates instead of scoring
+    for (uint32_t i = ents.first_ball + 1; i < ents.count; i++) {
+        if (ents.x[i] < 0 || ents.x[i] > width - ents.w[i]) {
+            ents.v_x[i] = -ents.v_x[i];
+        }
     }
-    return 1;
 }
 
-
 static void
-move_ball(struct game_data *data) {
-    ball_t *ball = &data->ball;
-    paddle_t *paddle_array = data->paddle;
-    struct surface_t *screen = &data->screen;
-    ball->rect.x += ball->v_x;
-    ball->rect.y += ball->v_y;
-
-    if (ball->rect.y < 0 || ball->rect.y > screen->height - 10) {
-        ball->v_y = -ball->v_y;
-    }
-    for (int i = 0; i < 2; i++) {
-        int collision = check_collision(ball, paddle_array + i);
-        if (collision) {
-            int y_offset = data->paddle[i].rect.y - ball->rect.y;
-            uint32_t extra_color = (i == 0) ? TEST_XRGB_ORANGERED : TEST_XRGB_WHITE;
-            effect_attach(&data->splash, (rectangle_t *)(paddle_array + i), i, 0, y_offset, extra_color);
-            if (ball->v_x < 0) {
-                ball->v_x -= 1;
-            } else {
-                ball->v_x += 1;
+collide_balls(void) {
+    for (uint32_t p = 0; p < PADDLE_COUNT; p++) {
+        int32_t px0 = ents.x[p], px1 = ents.x[p] + ents.w[p];
+        int32_t py0 = ents.y[p], py1 = ents.y[p] + ents.h[p];
+
+        for (uint32_t i = ents.first_ball; i < ents.count; i++) {
+            if (ents.x[i] > px1 || ents.x[i] + ents.w[i] < px0 ||
+                ents.y[i] > py1 || ents.y[i] + ents.h[i] < py0) {
+                continue;
             }
 
-            ball->v_x = -ball->v_x;
+            // only the game ball speeds up and splashes
+            if (i == ents.first_ball) {
+                int y_offset = ents.y[p] - ents.y[i];
+                uint32_t extra_color = (p == ENT_PADDLE_AI) ? TEST_XRGB_ORANGERED : TEST_XRGB_WHITE;
+                effect_attach(&game_info.splash, p, p, 0, y_offset, extra_color);
+                ents.v_x[i] += ents.v_x[i] < 0 ? -1 : 1;
+            }
 
-            int hit_pos = (paddle_array[i].rect.y + paddle_array[i].rect.h) - ball->rect.y;
+            ents.v_x[i] = -ents.v_x[i];
 
-            ball->v_y = 4 - hit_pos / 7;
+            int hit_pos = py1 - ents.y[i];
+            ents.v_y[i] = 4 - hit_pos / 7;
 
-            if (ball->rect.x < ball->rect.w) {
-                ball->rect.x = ball->rect.w;
+            if (ents.x[i] < ents.w[i]) {
+                ents.x[i] = ents.w[i];
             }
             // ball moving left
-            else if (ball->rect.x > MAX_WINDOW_WIDTH - ball->rect.w) {
-                ball->rect.x = MAX_WINDOW_WIDTH - ball->rect.w;
+            else if (ents.x[i] > MAX_WINDOW_WIDTH - ents.w[i]) {
+                ents.x[i] = MAX_WINDOW_WIDTH - ents.w[i];
             }
         }
     }
 }
 
+static void game_init();
+
+/* A point restarts the field, the score is the only state kept */
+static void
+score_points(void) {
+    uint32_t ball = ents.first_ball;
+
+    if (ents.x[ball] < 0) {
+        game_info.user_score += 1;
+        game_init();
+    }
+    if (ents.x[ball] > (int32_t)game_info.screen.width - ents.w[ball]) {
+        game_info.ai_score += 1;
+        game_init();
+    }
+}
+
+static bool
+game_won(void) {
+    return game_info.user_score == max_score || game_info.ai_score == max_score;
+}
 
+/* One simulation tick, game state depends on the sequence of ticks only */
 static void
-ball_init(ball_t *ball, int x, int y) {
-    ball->rect.x = x;
-    ball->rect.y = y;
-    ball->rect.w = ball_size;
-    ball->rect.h = ball_size;
-    ball->v_y = 1;
-    ball->v_x = 1;
-    ball->rect.draw = draw_ball;
-    ball->rect.move = move_ball;
-    ball->rect.color = TEST_XRGB_WHITE;
+game_tick(void) {
+    effect_tick(&game_info.splash);
+    save_positions();
+    move_paddle_ai();
+    move_paddle();
+    move_balls();
+    collide_balls();
+    score_points();
 }
 
 static void
@@ -288,7 +347,7 @@ effect_init(effect_t *e, enum EffectType type) {
     case SPLASH:
         e->frame = 0;
         e->y_mirror = 0;
-        e->traced_rect = 0;
+        e->traced = 0;
         e->enable = 0;
         break;
     default:
@@ -296,143 +355,180 @@ effect_init(effect_t *e, enum EffectType type) {
     }
 }
 
-static inline void
-paddle_init(paddle_t *paddle, int x, int y, uint32_t color, move_func move) {
-    paddle->rect.x = x;
-    paddle->rect.y = y;
-    paddle->rect.w = paddle_width;
-    paddle->rect.h = paddle_height;
-    paddle->rect.draw = draw_paddle;
-    paddle->rect.move = move;
-    paddle->rect.color = color;
-}
-
-static inline void
-net_init(rectangle_t *net, int width) {
-    net->x = width / 2;
-    net->y = 20;
-    net->w = 5;
-    net->h = 15;
-    net->draw = draw_net;
-    net->color = TEST_XRGB_GREY;
-}
-
-
-static inline void
-gates_init(rectangle_t *gate, struct surface_t *screen) {
-
-    for (int i = 0; i < 2; ++i) {
-        gate[i].color = TEST_XRGB_WHITE;
-        gate[i].draw = draw_gate;
-        gate[i].y = 0;
-        gate[i].h = screen->height;
+/* Stress balls start in the middle of the field with pseudo random speeds */
+static void
+stress_balls_init(uint32_t n) {
+    uint32_t seed = 0x2545F491;
+    struct surface_t *screen = &game_info.screen;
+
+    for (uint32_t k = 0; k < n; k++) {
+        seed = seed * 1103515245 + 12345;
+        int32_t x = screen->width / 4 + (seed >> 8) % (screen->width / 2);
+        seed = seed * 1103515245 + 12345;
+        int32_t y = (seed >> 8) % (screen->height - ball_size);
+        seed = seed * 1103515245 + 12345;
+
+        int i = entity_add(x, y, ball_size, ball_size, MAKE_ARGB(0, 0x80 | (seed >> 25), 0x80 | ((seed >> 17) & 0x7F), 0x80 | ((seed >> 9) & 0x7F)));
+        if (i < 0) {
+            cprintf("pong: only %u stress balls fit\n", k);
+            return;
+        }
+        ents.v_x[i] = (1 + (seed >> 4) % stress_max_speed) * (seed & 1 ? 1 : -1);
+        ents.v_y[i] = (1 + (seed >> 12) % stress_max_speed) * (seed & 2 ? 1 : -1);
     }
-    gate->x = 0;
-    gate->w = frame_width;
-
-    gate[1].x = screen->width - frame_width;
-    gate[1].w = frame_width;
 }
 
 static void
 game_init() {
-    surface_init(&game_info.screen, MAX_WINDOW_WIDTH, MAX_WINDOW_HEIGHT);
+    struct surface_t *screen = &game_info.screen;
 
-    ball_init(&game_info.ball, game_info.screen.width / 2, game_info.screen.height / 2);
+    ents.count = 0;
 
-    paddle_init(&game_info.paddle[0], paddle_padding, game_info.screen.height / 2 - paddle_height, TEST_XRGB_ORANGERED, move_paddle_ai);
-    game_info.paddle[0].v_y = player_paddle_speed;
-    paddle_init(&game_info.paddle[1], game_info.screen.width - paddle_padding - paddle_width, game_info.screen.height / 2 - paddle_height, TEST_XRGB_WHITE, move_paddle);
-    game_info.paddle[1].v_y = ai_paddle_speed;
+    entity_add(paddle_padding, screen->height / 2 - paddle_height, paddle_width, paddle_height, TEST_XRGB_ORANGERED);
+    ents.v_y[ENT_PADDLE_AI] = player_paddle_speed;
+    entity_add(screen->width - paddle_padding - paddle_width, screen->height / 2 - paddle_height,
+               paddle_width, paddle_height, TEST_XRGB_WHITE);
+    ents.v_y[ENT_PADDLE_USER] = ai_paddle_speed;
 
-    net_init(&game_info.net, game_info.screen.width);
-    gates_init(game_info.gates, &game_info.screen);
+    entity_add(0, 0, frame_width, screen->height, TEST_XRGB_WHITE);
+    entity_add(screen->width - frame_width, 0, frame_width, screen->height, TEST_XRGB_WHITE);
 
-    effect_init(&game_info.splash, SPLASH);
+    for (int i = 0; i < net_segments; i++) {
+        entity_add(screen->width / 2, 20 + i * net_offset, 5, 15, TEST_XRGB_GREY);
+    }
+
+    ents.first_ball = entity_add(screen->width / 2, screen->height / 2, ball_size, ball_size, TEST_XRGB_WHITE);
+    ents.v_x[ents.first_ball] = 1;
+    ents.v_y[ents.first_ball] = 1;
 
-    game_info.objects[0] = (rectangle_t *)&game_info.paddle[0];
-    game_info.objects[1] = (rectangle_t *)&game_info.paddle[1];
-    game_info.objects[2] = (rectangle_t *)&game_info.ball;
-    game_info.objects[3] = (rectangle_t *)&game_info.net;
-    game_info.objects[4] = (rectangle_t *)&game_info.gates[0];
-    game_info.objects[5] = (rectangle_t *)&game_info.gates[1];
+    stress_balls_init(game_info.stress_balls);
 
-    game_info.ndrawable = 6;
-    game_info.nmovable = 3;
+    effect_init(&game_info.splash, SPLASH);
 }
 
 
 static enum State
 check_game_over(struct game_data *info) {
     struct font_t *font = get_main_font();
-    // check over all games
-    if (info->ai_score == max_score) {
-        surface_draw_text(&game_info.screen, font, "You lose!", game_info.screen.height / 2, game_info.screen.width / 2);
-    } else if (info->user_score == max_score) {
-        surface_draw_text(&game_info.screen, font, "You win!", game_info.screen.height / 2, game_info.screen.width / 2);
-    }
-    if (info->user_score == max_score || info->ai_score == max_score) {
+    if (game_won()) {
+        // finish the frame recorded so far, then draw over it directly
+        dl_end(&info->dl);
+        dl_invalidate(&info->dl);
+
+        // dim the field under the final message
+        rect_t field = {0, 0, info->screen.width, info->screen.height};
+        surface_fade_rect(&info->screen, &field, game_over_dim);
+
+        // check over all games
+        static struct text_layout layout;
+        text_layout_init(&layout, font, &field, TEXT_ALIGN_CENTER);
+        text_layout_add(&layout, info->ai_score == max_score ? "You lose!" : "You win!", TEST_XRGB_WHITE);
+        text_layout_draw(&info->screen, &layout, NULL);
+
         surface_display(&game_info.screen);
-        sleep(500);
+        surface_end_frame(&game_info.screen);
+        if (!gfx_headless) {
+            sleep(500);
+        }
         return GAME_OVER;
     }
-    // check over one batch
-    if (info->ball.rect.x < 0) {
-        game_info.user_score += 1;
-        game_init();
-    }
-    if (info->ball.rect.x > info->screen.width - info->ball.rect.w) {
-        game_info.ai_score += 1;
-        game_init();
+    return GAME_RUN;
+}
+
+static enum State
+handle_input(enum Input input) {
+    switch (input) {
+    case INPUT_QUIT:
+        return GAME_OVER;
+    case INPUT_UP:
+        ents.v_y[ENT_PADDLE_USER] = -player_paddle_speed;
+        break;
+    case INPUT_DOWN:
+        ents.v_y[ENT_PADDLE_USER] = player_paddle_speed;
+        break;
+    case INPUT_STOP:
+        ents.v_y[ENT_PADDLE_USER] = 0;
+    default:
+        break;
     }
     return GAME_RUN;
 }
 
 int
-pong(void) {
+pong(uint32_t max_frames, uint32_t stress_balls) {
     enum State state = GAME_RUN;
+    struct frame_sched sched;
+    enum Input last_input = INPUT_NONE;
+    /* the latest change not yet seen by a tick, frames without ticks keep it */
+    enum Input pending_input = INPUT_NONE;
+    uint32_t tick = 0;
+
+    // the screen lives across rounds, so its frame counter keeps counting
+    surface_init(&game_info.screen, MAX_WINDOW_WIDTH, MAX_WINDOW_HEIGHT);
 
     // Initialize the ball position data.
+    game_info.stress_balls = stress_balls;
     game_init();
+    replay_begin();
+    // replays run one tick per frame, so frames can be compared one to one
+    frame_sched_init(&sched, sim_tick_hz, frame_hz, gfx_headless || replay_mode == REPLAY_PLAY);
+    prof_reset();
+    flush_keyboard();
+
+    while (state != GAME_OVER && !replay_done(tick) && (!max_frames || sched.frames < max_frames)) {
+        uint64_t frame_start = prof_start();
+        uint64_t t = frame_start;
+
+        // only changes are applied, the same way replays see them
+        enum Input input = get_keyboard_input();
+        if (input != last_input && pending_input != INPUT_QUIT) {
+            pending_input = input;
+        }
+        last_input = input;
+        prof_stop(PROF_INPUT, t);
+
+        t = prof_start();
+        for (uint32_t ticks = frame_sched_ticks(&sched); ticks > 0 && state != GAME_OVER && !game_won(); ticks--, tick++) {
+            state = handle_input(replay_key(tick, pending_input));
+            pending_input = INPUT_NONE;
+            game_tick();
+        }
+        game_info.alpha = frame_sched_alpha(&sched);
+        prof_stop(PROF_SIM, t);
 
-    while (state != GAME_OVER) {
-        int64_t next_game_tick = current_ms();
+        t = prof_start();
         // draw background
+        dl_begin(&game_info.dl, &game_info.screen, TEST_XRGB_BLACK);
+        draw_effect(&game_info.splash, &game_info.dl);
 
-        surface_clear(&game_info.screen, TEST_XRGB_BLACK);
-        draw_effect(&game_info.splash, &game_info.screen);
-
-        draw_number(&game_info.screen, game_info.screen.height / 2, 10, game_info.ai_score);
-        draw_number(&game_info.screen, game_info.screen.height / 2 + 110, 10, game_info.user_score);
+        draw_number(&game_info.dl, game_info.screen.height / 2, 10, game_info.ai_score);
+        draw_number(&game_info.dl, game_info.screen.height / 2 + 110, 10, game_info.user_score);
 
-        state = check_game_over(&game_info);
-        enum Key keyboard_key = get_last_keyboard_key();
-
-        switch (keyboard_key) {
-        case KEY_SPACE:
-            state = GAME_OVER;
-            break;
-        case KEY_UP:
-            game_info.paddle[1].v_y = -player_paddle_speed;
-            break;
-        case KEY_DOWN:
-            game_info.paddle[1].v_y = player_paddle_speed;
-            break;
-        case KEY_UNKNOWN:
-            game_info.paddle[1].v_y = 0;
-        default:
+        // the final frame is drawn by check_game_over()
+        if (check_game_over(&game_info) == GAME_OVER) {
             break;
         }
 
-        for (int i = 0; i < game_info.nmovable; ++i) {
-            game_info.objects[i]->move(&game_info);
-        }
-        for (int i = 0; i < game_info.ndrawable; ++i) {
-            game_info.objects[i]->draw(game_info.objects[i], &game_info.screen);
-        }
-        surface_display(&game_info.screen);
-        game_delay(next_game_tick);
+        draw_entities(&game_info.dl);
+        prof_stop(PROF_RECORD, t);
+
+        struct font_t *font = get_main_font();
+        prof_draw_hud(&game_info.dl, font, hud_padding,
+                      game_info.screen.height - hud_padding - PROF_HUD_HEIGHT(font));
+
+        dl_end(&game_info.dl);
+        surface_end_frame(&game_info.screen);
+
+        t = prof_start();
+        frame_sched_wait(&sched);
+        prof_stop(PROF_WAIT, t);
+
+        prof_frame_end(frame_start);
     }
+
+    replay_end(tick);
+    flush_keyboard();
+    frame_sched_report(&sched, "pong");
     surface_destroy(&game_info.screen);
     return 0;
 }
@@ -1,3 +1,7 @@
 #pragma once
 
-int pong(void);
\ No newline at end of file
+#include <inc/types.h>
+
+/* Runs until the game is over or max_frames frames are drawn (0 - no limit),
+ * stress_balls extra balls bounce around the field for benchmarking */
+int pong(uint32_t max_frames, uint32_t stress_balls);
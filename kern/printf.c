@@ -1,23 +1,25 @@
 /* Simple implementation of cprintf console output for the kernel,
- * based on printfmt() and the kernel console's cputchar() */
+ * based on vbprintfmt() and the kernel console's cons_write() */
 
 #include <inc/types.h>
 #include <inc/stdio.h>
 #include <inc/stdarg.h>
 
+#include <kern/console.h>
+
+#define CPRINTF_BUF 128
+
 static void
-putch(int ch, int *cnt) {
-    cputchar(ch);
-    (*cnt)++;
+cons_flush(struct fmtbuf *out) {
+    cons_write(out->buf, out->pos);
 }
 
 int
 vcprintf(const char *fmt, va_list ap) {
-    int count = 0;
-
-    vprintfmt((void *)putch, &count, fmt, ap);
+    char buf[CPRINTF_BUF];
+    struct fmtbuf out = {.buf = buf, .size = sizeof(buf), .flush = cons_flush};
 
-    return count;
+    return vbprintfmt(&out, fmt, ap);
 }
 
 int
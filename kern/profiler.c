@@ -0,0 +1,160 @@
+/* Per-stage frame profiler, see profiler.h */
+
+#include <inc/stdio.h>
+#include <inc/string.h>
+
+#include "profiler.h"
+#include "tsc.h"
+#include "trace.h"
+
+/* bars are PROF_HUD_BAR_WIDTH long at the frame budget */
+#define PROF_HUD_FRAME_US 16667
+#define PROF_HUD_UPDATE   15 /* frames between HUD text updates */
+
+int prof_flags = 0;
+
+static struct prof_stat prof_stats[PROF_NSTAGES];
+static uint32_t prof_frames;
+static uint64_t prof_cycles_us;
+
+static const char *const prof_stage_names[PROF_NSTAGES] = {
+        [PROF_FRAME] = "frame",
+        [PROF_INPUT] = "input",
+        [PROF_SIM] = "sim",
+        [PROF_RECORD] = "record",
+        [PROF_RASTER] = "raster",
+        [PROF_CONVERT] = "convert",
+        [PROF_TRANSFER] = "transfer",
+        [PROF_FLUSH] = "flush",
+        [PROF_WAIT] = "wait",
+        [PROF_HUD] = "hud",
+};
+
+static const uint32_t prof_stage_colors[PROF_NSTAGES] = {
+        [PROF_FRAME] = TEST_XRGB_WHITE,
+        [PROF_INPUT] = TEST_XRGB_GREY,
+        [PROF_SIM] = TEST_XRGB_ORANGERED,
+        [PROF_RECORD] = 0x00FFFF00,
+        [PROF_RASTER] = TEST_XRGB_RED,
+        [PROF_CONVERT] = 0xFF00FF00,
+        [PROF_TRANSFER] = TEST_XRGB_BLUE,
+        [PROF_FLUSH] = 0xFFFF0000,
+        [PROF_WAIT] = 0x40404000,
+        [PROF_HUD] = 0x00FF0000,
+};
+
+static uint64_t
+cycles_to_us(uint64_t cycles) {
+    if (!prof_cycles_us) {
+        prof_cycles_us = MAX(tsc_calibrate() / 1000000, 1);
+    }
+    return cycles / prof_cycles_us;
+}
+
+void
+prof_stop(enum prof_stage stage, uint64_t start) {
+    prof_stats[stage].frame += read_tsc() - start;
+    TRACE(STAGE, stage, start);
+}
+
+void
+prof_frame_end(uint64_t frame_start) {
+    prof_stats[PROF_FRAME].frame = read_tsc() - frame_start;
+    prof_frames++;
+    TRACE(FRAME, prof_frames, frame_start);
+
+    for (int i = 0; i < PROF_NSTAGES; i++) {
+        struct prof_stat *stat = &prof_stats[i];
+
+        /* start from the first sample instead of ramping up from 0 */
+        if (prof_frames == 1) {
+            stat->ema = stat->frame;
+        } else {
+            stat->ema = stat->ema - stat->ema / PROF_EMA_WEIGHT + stat->frame / PROF_EMA_WEIGHT;
+        }
+        stat->window_max = MAX(stat->window_max, stat->frame);
+        stat->frame = 0;
+
+        if (prof_frames % PROF_MAX_WINDOW == 0) {
+            stat->max = stat->window_max;
+            stat->window_max = 0;
+        }
+    }
+
+    if ((prof_flags & PROF_SHOW_SERIAL) && prof_frames % PROF_MAX_WINDOW == 0) {
+        prof_dump();
+    }
+}
+
+void
+prof_reset(void) {
+    memset(prof_stats, 0, sizeof(prof_stats));
+    prof_frames = 0;
+}
+
+const struct prof_stat *
+prof_stat(enum prof_stage stage) {
+    return &prof_stats[stage];
+}
+
+const char *
+prof_stage_name(enum prof_stage stage) {
+    return prof_stage_names[stage];
+}
+
+void
+prof_draw_hud(struct display_list *dl, struct font_t *font, uint32_t x, uint32_t y) {
+    static char text[16];
+    static struct {
+        uint64_t ema;
+        uint64_t max;
+    } shown[PROF_NSTAGES];
+
+    if (!(prof_flags & PROF_SHOW_HUD)) {
+        return;
+    }
+
+    uint64_t start = prof_start();
+
+    /* refresh numbers a few times a second, so the HUD tiles stay mostly clean */
+    if (prof_frames % PROF_HUD_UPDATE == 0) {
+        for (int i = 0; i < PROF_NSTAGES; i++) {
+            shown[i].ema = cycles_to_us(prof_stats[i].ema);
+            shown[i].max = cycles_to_us(prof_stats[i].max);
+        }
+
+        uint64_t frame_us = shown[PROF_FRAME].ema;
+        snprintf(text, sizeof(text), "%lu.%lums", (unsigned long)(frame_us / 1000),
+                 (unsigned long)(frame_us % 1000 / 100));
+    }
+
+    dl_draw_text(dl, font, text, x, y, TEST_XRGB_WHITE);
+    y += font->char_height;
+
+    for (int i = PROF_FRAME + 1; i < PROF_NSTAGES; i++, y += PROF_HUD_BAR_HEIGHT + 1) {
+        uint32_t avg = MIN(shown[i].ema * PROF_HUD_BAR_WIDTH / PROF_HUD_FRAME_US, PROF_HUD_BAR_WIDTH);
+        uint32_t max = MIN(shown[i].max * PROF_HUD_BAR_WIDTH / PROF_HUD_FRAME_US, PROF_HUD_BAR_WIDTH);
+
+        if (avg) {
+            rect_t bar = {x, y, avg, PROF_HUD_BAR_HEIGHT};
+            dl_fill_rect(dl, &bar, prof_stage_colors[i]);
+        }
+        /* tick at the maximum */
+        if (max > avg) {
+            rect_t tick = {x + max - 1, y, 1, PROF_HUD_BAR_HEIGHT};
+            dl_fill_rect(dl, &tick, prof_stage_colors[i]);
+        }
+    }
+
+    prof_stop(PROF_HUD, start);
+}
+
+void
+prof_dump(void) {
+    cprintf("prof: frames=%u", prof_frames);
+    for (int i = 0; i < PROF_NSTAGES; i++) {
+        cprintf(" %s=%lu/%lu", prof_stage_names[i], (unsigned long)cycles_to_us(prof_stats[i].ema),
+                (unsigned long)cycles_to_us(prof_stats[i].max));
+    }
+    cprintf("\n");
+}
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <inc/types.h>
+#include <inc/x86.h>
+
+#include "displaylist.h"
+
+/**
+ * Per-stage frame profiler.
+ *
+ * A stage is timed with a pair of TSC reads:
+ *
+ *   uint64_t t = prof_start();
+ *   ...
+ *   prof_stop(PROF_FLUSH, t);
+ *
+ * A stage may be entered several times per frame (e.g. one flush per
+ * damaged rect), the time is summed until prof_frame_end(), which folds
+ * it into a rolling average (1/PROF_EMA_WEIGHT of the new sample) and a
+ * maximum kept over the last PROF_MAX_WINDOW frames.
+ *
+ * Output is controlled by prof_flags: PROF_SHOW_HUD draws a small HUD
+ * (frame time and one bar per stage, relative to the frame budget) into
+ * the display list, PROF_SHOW_SERIAL prints the stats every
+ * PROF_MAX_WINDOW frames. The HUD text only changes a few times a second,
+ * so it costs the display list a couple of tiles per update.
+ */
+
+enum prof_stage {
+    PROF_FRAME,    /* whole frame, set by prof_frame_end() */
+    PROF_INPUT,    /* keyboard polling */
+    PROF_SIM,      /* simulation ticks */
+    PROF_RECORD,   /* draw callbacks recording the display list */
+    PROF_RASTER,   /* display list rasterization, including clear */
+    PROF_CONVERT,  /* pixel format conversion for the host */
+    PROF_TRANSFER, /* transfer_to_host_2D */
+    PROF_FLUSH,    /* resource flush */
+    PROF_WAIT,     /* waiting for the frame deadline */
+    PROF_HUD,      /* the profiler itself */
+    PROF_NSTAGES,
+};
+
+#define PROF_EMA_WEIGHT 16
+#define PROF_MAX_WINDOW 60
+
+/* HUD geometry */
+#define PROF_HUD_BAR_WIDTH   128
+#define PROF_HUD_BAR_HEIGHT  3
+#define PROF_HUD_HEIGHT(font) ((font)->char_height + (PROF_NSTAGES - 1) * (PROF_HUD_BAR_HEIGHT + 1))
+
+/* prof_flags */
+#define PROF_SHOW_HUD    0x1
+#define PROF_SHOW_SERIAL 0x2
+
+struct prof_stat {
+    uint64_t frame; /* summed over the current frame */
+    uint64_t ema;
+    uint64_t max;
+    uint64_t window_max;
+};
+
+extern int prof_flags;
+
+static inline uint64_t
+prof_start(void) {
+    return read_tsc();
+}
+
+void prof_stop(enum prof_stage stage, uint64_t start);
+
+/* Folds this frame's times into the stats, frame_start is TSC of its start */
+void prof_frame_end(uint64_t frame_start);
+void prof_reset(void);
+
+const struct prof_stat *prof_stat(enum prof_stage stage);
+const char *prof_stage_name(enum prof_stage stage);
+
+/* Record the HUD at x, y if PROF_SHOW_HUD is set */
+void prof_draw_hud(struct display_list *dl, struct font_t *font, uint32_t x, uint32_t y);
+/* "prof: <stage>=<avg us>/<max us> ..." */
+void prof_dump(void);
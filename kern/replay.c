@@ -0,0 +1,78 @@
+/* Input recording and replay, see replay.h */
+
+#include <inc/stdio.h>
+
+#include "replay.h"
+
+enum replay_mode replay_mode = REPLAY_OFF;
+
+static struct {
+    uint32_t ticks;
+    uint32_t nevents;
+    bool truncated;
+    struct input_event events[REPLAY_MAX_EVENTS];
+} recording;
+
+/* next event to play */
+static uint32_t replay_pos;
+
+void
+replay_begin(void) {
+    if (replay_mode == REPLAY_RECORD) {
+        recording.ticks = 0;
+        recording.nevents = 0;
+        recording.truncated = false;
+    }
+    replay_pos = 0;
+}
+
+int
+replay_key(uint32_t tick, int live_key) {
+    switch (replay_mode) {
+    case REPLAY_RECORD:
+        if (!live_key || recording.truncated ||
+            (recording.nevents && recording.events[recording.nevents - 1].key == live_key)) {
+            return live_key;
+        }
+        if (recording.nevents == REPLAY_MAX_EVENTS) {
+            cprintf("replay: too many events, recording stops at tick %u\n", tick);
+            recording.truncated = true;
+            recording.ticks = tick;
+            return live_key;
+        }
+        recording.events[recording.nevents++] = (struct input_event){tick, live_key};
+        return live_key;
+
+    case REPLAY_PLAY:
+        /* several events on one tick, the last one wins like with live input */
+        live_key = 0;
+        while (replay_pos < recording.nevents && recording.events[replay_pos].tick == tick) {
+            live_key = recording.events[replay_pos++].key;
+        }
+        return live_key;
+
+    default:
+        return live_key;
+    }
+}
+
+bool
+replay_done(uint32_t tick) {
+    return replay_mode == REPLAY_PLAY && tick >= recording.ticks;
+}
+
+void
+replay_end(uint32_t ticks) {
+    if (replay_mode == REPLAY_RECORD && !recording.truncated) {
+        recording.ticks = ticks;
+    }
+}
+
+void
+replay_dump(void) {
+    cprintf("replay: ticks=%u events=%u%s\n", recording.ticks, recording.nevents,
+            recording.truncated ? " truncated" : "");
+    for (uint32_t i = 0; i < recording.nevents; i++) {
+        cprintf("replay: event tick=%u key=%d\n", recording.events[i].tick, recording.events[i].key);
+    }
+}
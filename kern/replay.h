@@ -0,0 +1,45 @@
+#pragma once
+
+#include <inc/types.h>
+
+/**
+ * Input recording and deterministic replay.
+ *
+ * The game asks replay_key() for its input on every simulation tick. In
+ * record mode the live key is passed through and stored together with
+ * the tick number, in play mode the live key is ignored and the recorded
+ * one is returned instead. Key 0 means "no input on this tick" and is
+ * never stored. Keys are treated as state (e.g. "paddle goes up"), so a
+ * key equal to the previous stored one is not stored again.
+ *
+ * The recording also stores its length in ticks, so playback runs the
+ * same fixed-length game every time. The mode stays set between games,
+ * so a recording can be played back many times.
+ */
+
+#define REPLAY_MAX_EVENTS 4096
+
+enum replay_mode {
+    REPLAY_OFF,
+    REPLAY_RECORD,
+    REPLAY_PLAY,
+};
+
+struct input_event {
+    uint32_t tick;
+    int key;
+};
+
+extern enum replay_mode replay_mode;
+
+/* Start of a game */
+void replay_begin(void);
+/* Key for this tick, see above */
+int replay_key(uint32_t tick, int live_key);
+/* Playback reached the end of the recording */
+bool replay_done(uint32_t tick);
+/* End of a game, ticks is its length */
+void replay_end(uint32_t ticks);
+
+/* "replay: ticks=... events=..." followed by one "replay: event tick=... key=..." per event */
+void replay_dump(void);
@@ -0,0 +1,187 @@
+/* Sprite atlas and batched sprite renderer, see sprite.h */
+
+#include <inc/string.h>
+#include <inc/stdio.h>
+#include <inc/error.h>
+
+#include "sprite.h"
+#include "pixel.h"
+
+/* Rows of the screen sprites are grouped by when sorting */
+#define SPRITE_BAND_SHIFT 4
+
+int
+sprite_atlas_load(struct sprite_atlas *atlas, const char *name) {
+    uint32_t first = atlas->nsprites;
+    uint32_t nframes = asset_frames(name);
+
+    if (!nframes || first + nframes > SPRITE_MAX) {
+        return -E_INVAL;
+    }
+
+    for (uint32_t i = 0; i < nframes; i++) {
+        const struct asset_pack_entry *entry = asset_find(name, i);
+        if (entry->raw_size < (size_t)entry->width * entry->height * sizeof(uint32_t)) {
+            return -E_INVAL;
+        }
+
+        atlas->sprites[first + i] = (struct sprite){
+                .entry = entry,
+                .width = entry->width,
+                .height = entry->height};
+    }
+    atlas->nsprites += nframes;
+
+    return first;
+}
+
+struct sprite_atlas *
+get_main_atlas(void) {
+    static struct sprite_atlas atlas;
+    static bool is_loaded = false;
+
+    if (!is_loaded) {
+        int res = sprite_atlas_load(&atlas, "splash");
+        if (res < 0) {
+            panic("sprite atlas: can't load splash: %i", res);
+        }
+        is_loaded = true;
+    }
+
+    return &atlas;
+}
+
+static uint32_t
+sprite_draw_key(const struct sprite_draw *draw) {
+    uint32_t band = MIN((uint32_t)MAX(draw->y, 0) >> SPRITE_BAND_SHIFT, 0xFFU);
+
+    return ((uint32_t)draw->layer << 24) | (band << 16) | draw->sprite;
+}
+
+/* LSD radix sort of (key, index) pairs, digits that are equal for all
+ * entries (usually the layer) are skipped */
+void
+sprite_batch_sort(struct sprite_draw *draws, size_t n) {
+    static uint32_t keys[2][SPRITE_BATCH_MAX];
+    static uint16_t index[2][SPRITE_BATCH_MAX];
+    static struct sprite_draw sorted[SPRITE_BATCH_MAX];
+
+    assert(n <= SPRITE_BATCH_MAX);
+    if (n < 2) {
+        return;
+    }
+
+    int cur = 0;
+    for (size_t i = 0; i < n; i++) {
+        keys[0][i] = sprite_draw_key(&draws[i]);
+        index[0][i] = i;
+    }
+
+    for (int shift = 0; shift < 32; shift += 8) {
+        size_t count[256] = {0};
+
+        for (size_t i = 0; i < n; i++) {
+            count[(keys[cur][i] >> shift) & 0xFF]++;
+        }
+        if (count[(keys[cur][0] >> shift) & 0xFF] == n) {
+            continue;
+        }
+
+        size_t pos = 0;
+        for (int d = 0; d < 256; d++) {
+            size_t c = count[d];
+            count[d] = pos;
+            pos += c;
+        }
+
+        for (size_t i = 0; i < n; i++) {
+            size_t to = count[(keys[cur][i] >> shift) & 0xFF]++;
+            keys[!cur][to] = keys[cur][i];
+            index[!cur][to] = index[cur][i];
+        }
+        cur = !cur;
+    }
+
+    for (size_t i = 0; i < n; i++) {
+        sorted[i] = draws[index[cur][i]];
+    }
+    memcpy(draws, sorted, n * sizeof(*draws));
+}
+
+static void
+sprite_draw_one(struct surface_t *surface, const struct sprite *sprite, const struct sprite_draw *draw) {
+    rect_t rect = {draw->x, draw->y, sprite->width, sprite->height};
+    rect_t clip;
+    if (!surface_clip_rect(surface, &rect, &clip)) {
+        return;
+    }
+
+    uint32_t tx = clip.x - rect.x;
+    uint32_t ty = clip.y - rect.y;
+    const uint32_t *pixels = asset_frame(sprite->entry);
+
+    for (uint32_t y = 0; y < clip.height; y++) {
+        uint32_t *dst = surface->backbuf + (clip.y + y) * surface->width + clip.x;
+        const uint32_t *src = pixels + (ty + y) * sprite->width;
+
+        if (!draw->flags) {
+            memcpy(dst, src + tx, clip.width * sizeof(*dst));
+            continue;
+        }
+
+        for (uint32_t x = 0; x < clip.width; x++) {
+            uint32_t pixel = draw->flags & SPRITE_MIRROR ? src[sprite->width - 1 - tx - x] : src[tx + x];
+
+            if ((draw->flags & SPRITE_TINT) && pixel == TEST_XRGB_WHITE) {
+                pixel = draw->color;
+            }
+
+            if (!(draw->flags & SPRITE_BLEND) || PIXEL_A(pixel) == 0xFF) {
+                dst[x] = pixel;
+            } else if (PIXEL_A(pixel)) {
+                dst[x] = pixel_over(dst[x], pixel);
+            }
+        }
+    }
+}
+
+void
+sprite_batch_draw_sorted(struct surface_t *surface, const struct sprite_atlas *atlas,
+                         const struct sprite_draw *draws, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        if (draws[i].sprite < atlas->nsprites) {
+            sprite_draw_one(surface, &atlas->sprites[draws[i].sprite], &draws[i]);
+        }
+    }
+}
+
+void
+sprite_batch_draw(struct surface_t *surface, const struct sprite_atlas *atlas,
+                  struct sprite_draw *draws, size_t n) {
+    sprite_batch_sort(draws, n);
+    sprite_batch_draw_sorted(surface, atlas, draws, n);
+}
+
+bool
+sprite_batch_bounds(const struct sprite_atlas *atlas, const struct sprite_draw *draws, size_t n, rect_t *bounds) {
+    int64_t x0 = INT64_MAX, y0 = INT64_MAX, x1 = INT64_MIN, y1 = INT64_MIN;
+
+    for (size_t i = 0; i < n; i++) {
+        if (draws[i].sprite >= atlas->nsprites) {
+            continue;
+        }
+
+        const struct sprite *sprite = &atlas->sprites[draws[i].sprite];
+        x0 = MIN(x0, (int64_t)draws[i].x);
+        y0 = MIN(y0, (int64_t)draws[i].y);
+        x1 = MAX(x1, (int64_t)draws[i].x + sprite->width);
+        y1 = MAX(y1, (int64_t)draws[i].y + sprite->height);
+    }
+
+    if (x0 >= x1) {
+        return false;
+    }
+
+    *bounds = (rect_t){x0, y0, x1 - x0, y1 - y0};
+    return true;
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include "graphic.h"
+#include "assets.h"
+
+/**
+ * Sprite atlas and batched sprite drawing.
+ *
+ * The atlas is built once from the asset pack linked into the kernel,
+ * every animation frame becomes a sprite. Sprite pixels are decoded on
+ * demand through the asset frame cache.
+ *
+ * A batch is an array of sprite_draw entries drawn in one call. Entries
+ * are sorted by layer, then by screen band and sprite, so the backbuf
+ * is walked top to bottom and each sprite's pixels are reused while
+ * they are in cache. Only the layer order is kept when sprites overlap.
+ */
+
+#define SPRITE_MAX       64
+#define SPRITE_BATCH_MAX 4096
+
+/* Sprite draw flags */
+#define SPRITE_MIRROR 0x1 /* flip horizontally */
+#define SPRITE_TINT   0x2 /* replace white pixels with color */
+#define SPRITE_BLEND  0x4 /* pixels are premultiplied ARGB, blend them */
+
+struct sprite {
+    const struct asset_pack_entry *entry;
+    uint16_t width;
+    uint16_t height;
+};
+
+struct sprite_atlas {
+    uint32_t nsprites;
+    struct sprite sprites[SPRITE_MAX];
+};
+
+struct sprite_draw {
+    uint16_t sprite;
+    uint8_t layer; /* drawn in increasing order */
+    uint8_t flags;
+    int32_t x;
+    int32_t y;
+    uint32_t color; /* for SPRITE_TINT */
+};
+
+/* Atlas with all frames of the splash animation */
+struct sprite_atlas *get_main_atlas(void);
+
+/* Add all frames of an asset, returns index of the first one */
+int sprite_atlas_load(struct sprite_atlas *atlas, const char *name);
+
+/* Sort in place, the order sprite_batch_draw_sorted() expects */
+void sprite_batch_sort(struct sprite_draw *draws, size_t n);
+
+void sprite_batch_draw_sorted(struct surface_t *surface, const struct sprite_atlas *atlas,
+                              const struct sprite_draw *draws, size_t n);
+
+/* Sort (in place) and draw the whole batch */
+void sprite_batch_draw(struct surface_t *surface, const struct sprite_atlas *atlas,
+                       struct sprite_draw *draws, size_t n);
+
+/* Bounding box of the batch, false if empty */
+bool sprite_batch_bounds(const struct sprite_atlas *atlas, const struct sprite_draw *draws, size_t n, rect_t *bounds);
@@ -0,0 +1,194 @@
+/* Text layout: measuring, wrapping and drawing runs of text */
+
+#include <inc/error.h>
+#include <inc/string.h>
+
+#include "text.h"
+
+struct text_extent
+text_measure(const struct font_t *font, const char *str) {
+    uint32_t lines = 1, columns = 0, max_columns = 0;
+
+    for (; *str; str++) {
+        if (*str == '\n') {
+            lines++;
+            columns = 0;
+        } else {
+            max_columns = MAX(max_columns, ++columns);
+        }
+    }
+
+    return (struct text_extent){
+            .width = max_columns * font->char_width,
+            .height = lines * font->char_height};
+}
+
+void
+text_layout_init(struct text_layout *layout, struct font_t *font, const rect_t *box, int align) {
+    memset(layout, 0, sizeof(*layout));
+
+    layout->font = font;
+    layout->box = *box;
+    layout->align = align;
+}
+
+static int
+text_new_line(struct text_layout *layout) {
+    uint32_t lines = layout->line + 2;
+
+    if (lines > TEXT_MAX_LINES || lines * layout->font->char_height > layout->box.height) {
+        return -E_NO_MEM;
+    }
+
+    layout->line++;
+    layout->pen_x = 0;
+    return 0;
+}
+
+/* Append len characters at the pen, merging with the previous piece when possible */
+static int
+text_place(struct text_layout *layout, const char *str, uint32_t len, uint32_t color) {
+    struct text_piece *last = layout->npieces ? &layout->pieces[layout->npieces - 1] : NULL;
+
+    if (last && last->line == layout->line && last->color == color &&
+        last->str + last->len == str &&
+        last->x + last->len * layout->font->char_width == layout->pen_x) {
+        last->len += len;
+    } else {
+        if (layout->npieces == TEXT_MAX_PIECES) {
+            return -E_NO_MEM;
+        }
+
+        layout->pieces[layout->npieces++] = (struct text_piece){
+                .str = str,
+                .len = len,
+                .color = color,
+                .x = layout->pen_x,
+                .line = layout->line};
+    }
+
+    layout->pen_x += len * layout->font->char_width;
+    return 0;
+}
+
+int
+text_layout_add(struct text_layout *layout, const char *str, uint32_t color) {
+    uint32_t char_width = layout->font->char_width;
+    uint32_t max_columns = MAX(layout->box.width / char_width, 1);
+    int res;
+
+    while (*str) {
+        uint32_t column = layout->pen_x / char_width;
+
+        if (*str == '\n') {
+            if ((res = text_new_line(layout)) < 0) return res;
+            str++;
+            continue;
+        }
+
+        uint32_t len = 0;
+        if (*str == ' ') {
+            while (str[len] == ' ') len++;
+
+            /* spaces at the wrap point are dropped */
+            if (column + len >= max_columns) {
+                str += len;
+                if (*str && *str != '\n' && (res = text_new_line(layout)) < 0) return res;
+                continue;
+            }
+        } else {
+            while (str[len] && str[len] != ' ' && str[len] != '\n') len++;
+
+            if (column + len > max_columns) {
+                if (column) {
+                    if ((res = text_new_line(layout)) < 0) return res;
+                    continue;
+                }
+                /* word is wider than the box, cut it */
+                len = max_columns;
+            }
+        }
+
+        if ((res = text_place(layout, str, len, color)) < 0) return res;
+        if (*str != ' ') {
+            layout->line_width[layout->line] = layout->pen_x;
+        }
+        str += len;
+    }
+
+    return 0;
+}
+
+static uint32_t
+text_line_x(const struct text_layout *layout, uint32_t line) {
+    uint32_t free = layout->box.width - MIN(layout->line_width[line], layout->box.width);
+
+    if (layout->align & TEXT_ALIGN_HCENTER) {
+        return layout->box.x + free / 2;
+    }
+    if (layout->align & TEXT_ALIGN_RIGHT) {
+        return layout->box.x + free;
+    }
+    return layout->box.x;
+}
+
+static uint32_t
+text_line_y(const struct text_layout *layout, uint32_t line) {
+    uint32_t height = (layout->line + 1) * layout->font->char_height;
+    uint32_t y = layout->box.y + line * layout->font->char_height;
+
+    if (layout->align & TEXT_ALIGN_VCENTER) {
+        y += (layout->box.height - MIN(height, layout->box.height)) / 2;
+    }
+    return y;
+}
+
+void
+text_layout_extent(const struct text_layout *layout, rect_t *extent) {
+    uint32_t x0 = UINT32_MAX, x1 = 0;
+
+    for (uint32_t line = 0; line <= layout->line; line++) {
+        if (!layout->line_width[line]) {
+            continue;
+        }
+
+        uint32_t x = text_line_x(layout, line);
+        x0 = MIN(x0, x);
+        x1 = MAX(x1, x + layout->line_width[line]);
+    }
+
+    if (x0 >= x1) {
+        *extent = (rect_t){0, 0, 0, 0};
+        return;
+    }
+
+    extent->x = x0;
+    extent->y = text_line_y(layout, 0);
+    extent->width = x1 - x0;
+    extent->height = (layout->line + 1) * layout->font->char_height;
+}
+
+void
+text_layout_draw(struct surface_t *surface, const struct text_layout *layout, rect_t *damage) {
+    for (uint32_t i = 0; i < layout->npieces; i++) {
+        const struct text_piece *piece = &layout->pieces[i];
+
+        surface_draw_text_run(surface, layout->font, piece->str, piece->len,
+                              text_line_x(layout, piece->line) + piece->x,
+                              text_line_y(layout, piece->line), piece->color);
+    }
+
+    if (!damage) {
+        return;
+    }
+
+    text_layout_extent(layout, damage);
+
+    if (damage->x >= surface->width || damage->y >= surface->height) {
+        *damage = (rect_t){0, 0, 0, 0};
+        return;
+    }
+
+    damage->width = MIN(damage->width, surface->width - damage->x);
+    damage->height = MIN(damage->height, surface->height - damage->y);
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "graphic.h"
+
+/**
+ * Text layout on top of surface_draw_text_run().
+ *
+ * Runs (string + color) are added to a layout one after another and flow
+ * like a paragraph inside the layout box: '\n' starts a new line and
+ * lines are wrapped on spaces to the box width (words wider than the box
+ * are cut). Layout is done while runs are added, drawing only walks the
+ * resulting pieces, one text_run call per piece, and reports the damaged
+ * rectangle so it can be passed to surface_update_rect().
+ */
+
+#define TEXT_MAX_PIECES 64
+#define TEXT_MAX_LINES  32
+
+/* Alignment flags, horizontal alignment is per line */
+#define TEXT_ALIGN_LEFT    0x0
+#define TEXT_ALIGN_HCENTER 0x1
+#define TEXT_ALIGN_RIGHT   0x2
+#define TEXT_ALIGN_VCENTER 0x4
+#define TEXT_ALIGN_CENTER  (TEXT_ALIGN_HCENTER | TEXT_ALIGN_VCENTER)
+
+struct text_extent {
+    uint32_t width;
+    uint32_t height;
+};
+
+/* Part of a run placed on one line, x/y are relative to the layout box */
+struct text_piece {
+    const char *str;
+    uint32_t len;
+    uint32_t color;
+    uint32_t x;
+    uint32_t line;
+};
+
+struct text_layout {
+    struct font_t *font;
+    rect_t box;
+    int align;
+
+    /* current pen position */
+    uint32_t pen_x;
+    uint32_t line;
+
+    uint32_t line_width[TEXT_MAX_LINES];
+
+    uint32_t npieces;
+    struct text_piece pieces[TEXT_MAX_PIECES];
+};
+
+/* Size of str when drawn unwrapped, '\n' starts a new line */
+struct text_extent text_measure(const struct font_t *font, const char *str);
+
+void text_layout_init(struct text_layout *layout, struct font_t *font, const rect_t *box, int align);
+
+/* Returns -E_NO_MEM if the text doesn't fit into the layout (it is cut) */
+int text_layout_add(struct text_layout *layout, const char *str, uint32_t color);
+
+/* Bounding box of the laid out text in surface coordinates */
+void text_layout_extent(const struct text_layout *layout, rect_t *extent);
+
+/* Draw all pieces, damage (if not NULL) gets the touched area clipped to surface */
+void text_layout_draw(struct surface_t *surface, const struct text_layout *layout, rect_t *damage);
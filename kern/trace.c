@@ -0,0 +1,272 @@
+/* Static tracepoints, see trace.h */
+
+#include <inc/stdio.h>
+#include <inc/string.h>
+#include <inc/x86.h>
+
+#include "console.h"
+#include "profiler.h"
+#include "trace.h"
+#include "tsc.h"
+
+uint64_t trace_mask = 0;
+
+static struct trace_ring {
+    uint64_t head; /* records written, free running */
+    struct trace_record records[TRACE_RECORDS];
+} trace_rings[NCPU];
+
+static const struct {
+    const char *name;
+    const char *args[2];
+} trace_events[TRACE_NEVENTS] = {
+#define TRACE_DESC(id, name, arg0, arg1) [TRACE_##id] = {name, {arg0, arg1}},
+        TRACE_EVENTS(TRACE_DESC)
+#undef TRACE_DESC
+};
+
+/* There is a single CPU for now */
+static inline uint16_t
+trace_cpu(void) {
+    return 0;
+}
+
+void
+trace_emit(enum trace_event event, uint64_t arg0, uint64_t arg1) {
+    uint16_t cpu = trace_cpu();
+    struct trace_ring *ring = &trace_rings[cpu];
+    struct trace_record *rec = &ring->records[ring->head % TRACE_RECORDS];
+
+    *rec = (struct trace_record){read_tsc(), event, cpu, 0, {arg0, arg1}};
+    /* the record is complete before it is counted */
+    asm volatile("" ::: "memory");
+    ring->head++;
+}
+
+const char *
+trace_event_name(enum trace_event event) {
+    return trace_events[event].name;
+}
+
+const char *
+trace_arg_name(enum trace_event event, int arg) {
+    return trace_events[event].args[arg];
+}
+
+int
+trace_event_parse(const char *name) {
+    for (int i = 0; i < TRACE_NEVENTS; i++) {
+        if (!strcmp(name, trace_events[i].name)) return i;
+    }
+    return -1;
+}
+
+void
+trace_stats(uint64_t *written, uint64_t *lost) {
+    *written = *lost = 0;
+    for (int cpu = 0; cpu < NCPU; cpu++) {
+        *written += trace_rings[cpu].head;
+        *lost += trace_rings[cpu].head > TRACE_RECORDS ? trace_rings[cpu].head - TRACE_RECORDS : 0;
+    }
+}
+
+void
+trace_clear(void) {
+    for (int cpu = 0; cpu < NCPU; cpu++) {
+        trace_rings[cpu].head = 0;
+    }
+}
+
+void
+trace_iter_begin(struct trace_iter *iter) {
+    for (int cpu = 0; cpu < NCPU; cpu++) {
+        uint64_t head = trace_rings[cpu].head;
+        iter->pos[cpu] = head > TRACE_RECORDS ? head - TRACE_RECORDS : 0;
+    }
+}
+
+const struct trace_record *
+trace_iter_next(struct trace_iter *iter) {
+    const struct trace_record *next = NULL;
+    int next_cpu = 0;
+
+    for (int cpu = 0; cpu < NCPU; cpu++) {
+        if (iter->pos[cpu] == trace_rings[cpu].head) continue;
+
+        const struct trace_record *rec = &trace_rings[cpu].records[iter->pos[cpu] % TRACE_RECORDS];
+        if (!next || rec->tsc < next->tsc) {
+            next = rec;
+            next_cpu = cpu;
+        }
+    }
+
+    if (next) iter->pos[next_cpu]++;
+    return next;
+}
+
+void
+trace_dump(uint32_t max) {
+    uint64_t cycles_us = MAX(tsc_calibrate() / 1000000, 1);
+    uint64_t written, lost;
+    struct trace_iter iter;
+    const struct trace_record *rec;
+
+    trace_stats(&written, &lost);
+    uint64_t left = written - lost;
+    uint64_t skip = max && left > max ? left - max : 0;
+
+    trace_iter_begin(&iter);
+    while ((rec = trace_iter_next(&iter))) {
+        if (skip) {
+            skip--;
+            continue;
+        }
+
+        cprintf("trace: %lu cpu=%u %s", (unsigned long)(rec->tsc / cycles_us), rec->cpu,
+                trace_event_name(rec->event));
+        for (int i = 0; i < 2; i++) {
+            const char *arg = trace_arg_name(rec->event, i);
+            if (arg) cprintf(" %s=0x%lx", arg, (unsigned long)rec->args[i]);
+        }
+        cprintf("\n");
+    }
+    cprintf("trace: records=%lu lost=%lu\n", (unsigned long)written, (unsigned long)lost);
+}
+
+static struct {
+    uint64_t base;      /* TSC of time 0 */
+    uint64_t cycles_us; /* TSC ticks per microsecond */
+    /* open spans by CPU */
+    struct trace_record trap[NCPU];
+    struct trace_record run[NCPU];
+} export;
+
+static void
+trace_export_printf(const char *fmt, ...) {
+    char line[256];
+    va_list ap;
+
+    va_start(ap, fmt);
+    int len = vsnprintf(line, sizeof(line), fmt, ap);
+    va_end(ap);
+
+    serial_write(line, MIN(MAX(len, 0), (int)sizeof(line) - 1));
+}
+
+/* Chrome wants microseconds, fractions give nanosecond resolution */
+static void
+trace_export_us(char *buf, size_t size, uint64_t cycles) {
+    uint64_t ns = cycles * 1000 / export.cycles_us;
+    snprintf(buf, size, "%lu.%03lu", (unsigned long)(ns / 1000), (unsigned long)(ns % 1000));
+}
+
+static void
+trace_export_span(const char *name, const char *cat, uint16_t cpu, uint64_t start, uint64_t end,
+                  const struct trace_record *rec) {
+    char ts[24], dur[24];
+
+    trace_export_us(ts, sizeof(ts), start - MIN(start, export.base));
+    trace_export_us(dur, sizeof(dur), end - MIN(end, start));
+    trace_export_printf(",{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"X\",\"pid\":0,\"tid\":%u,"
+                        "\"ts\":%s,\"dur\":%s,\"args\":{\"%s\":%lu}}\n",
+                        name, cat, cpu, ts, dur, trace_arg_name(rec->event, 0), (unsigned long)rec->args[0]);
+}
+
+static void
+trace_export_instant(const struct trace_record *rec) {
+    char ts[24];
+
+    trace_export_us(ts, sizeof(ts), rec->tsc - MIN(rec->tsc, export.base));
+    trace_export_printf(",{\"name\":\"%s\",\"ph\":\"i\",\"s\":\"t\",\"pid\":0,\"tid\":%u,\"ts\":%s,\"args\":{",
+                        trace_event_name(rec->event), rec->cpu, ts);
+    for (int i = 0; i < 2; i++) {
+        const char *arg = trace_arg_name(rec->event, i);
+        if (arg) trace_export_printf("%s\"%s\":%lu", i ? "," : "", arg, (unsigned long)rec->args[i]);
+    }
+    trace_export_printf("}}\n");
+}
+
+/* Ends the open trap and env run spans of the CPU */
+static void
+trace_export_close(uint16_t cpu, uint64_t end) {
+    struct trace_record *trap = &export.trap[cpu];
+    struct trace_record *run = &export.run[cpu];
+    char name[32];
+
+    if (trap->tsc) {
+        snprintf(name, sizeof(name), "trap %lu", (unsigned long)trap->args[0]);
+        trace_export_span(name, "kernel", cpu, trap->tsc, end, trap);
+        trap->tsc = 0;
+    }
+    if (run->tsc) {
+        snprintf(name, sizeof(name), "env %lx", (unsigned long)run->args[0]);
+        trace_export_span(name, "user", cpu, run->tsc, end, run);
+        run->tsc = 0;
+    }
+}
+
+static void
+trace_export_record(const struct trace_record *rec) {
+    char name[32];
+
+    switch (rec->event) {
+    case TRACE_TRAP:
+        /* a trap taken before returning to user mode has no end of its own */
+        if (export.trap[rec->cpu].tsc) trace_export_instant(&export.trap[rec->cpu]);
+        export.trap[rec->cpu].tsc = 0;
+        trace_export_close(rec->cpu, rec->tsc);
+        export.trap[rec->cpu] = *rec;
+        break;
+    case TRACE_ENV_RUN:
+        trace_export_close(rec->cpu, rec->tsc);
+        export.run[rec->cpu] = *rec;
+        break;
+    case TRACE_STAGE:
+        trace_export_span(prof_stage_name((enum prof_stage)rec->args[0]), "frame", rec->cpu, rec->args[1], rec->tsc, rec);
+        break;
+    case TRACE_FRAME:
+        trace_export_span("frame", "frame", rec->cpu, rec->args[1], rec->tsc, rec);
+        break;
+    case TRACE_GPU_CMD:
+        snprintf(name, sizeof(name), "gpu %lx", (unsigned long)rec->args[0]);
+        trace_export_span(name, "gpu", rec->cpu, rec->args[1], rec->tsc, rec);
+        break;
+    default:
+        trace_export_instant(rec);
+    }
+}
+
+void
+trace_export(void) {
+    struct trace_iter iter;
+    const struct trace_record *rec;
+
+    memset(&export, 0, sizeof(export));
+    export.cycles_us = MAX(tsc_calibrate() / 1000000, 1);
+
+    /* spans start before their record, the earliest is the base */
+    export.base = ~0ULL;
+    trace_iter_begin(&iter);
+    while ((rec = trace_iter_next(&iter))) {
+        bool span = rec->event == TRACE_STAGE || rec->event == TRACE_FRAME || rec->event == TRACE_GPU_CMD;
+        export.base = MIN(export.base, span ? MIN(rec->args[1], rec->tsc) : rec->tsc);
+    }
+
+    trace_export_printf("trace-json: begin\n");
+    trace_export_printf("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n");
+    trace_export_printf("{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":0,\"args\":{\"name\":\"JOS\"}}\n");
+
+    trace_iter_begin(&iter);
+    while ((rec = trace_iter_next(&iter))) {
+        trace_export_record(rec);
+    }
+
+    /* whatever is still open ends with the export */
+    uint64_t now = read_tsc();
+    for (uint16_t cpu = 0; cpu < NCPU; cpu++) {
+        trace_export_close(cpu, now);
+    }
+
+    trace_export_printf("]}\n");
+    trace_export_printf("trace-json: end\n");
+}
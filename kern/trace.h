@@ -0,0 +1,97 @@
+#pragma once
+
+#include <inc/types.h>
+
+#include <kern/cpu.h>
+
+/**
+ * Static tracepoints.
+ *
+ *   TRACE(ENV_RUN, env->env_id, env->env_tf.tf_rip);
+ *
+ * compiles to a test of one bit of trace_mask, so a disabled tracepoint
+ * costs a load and a not-taken branch. Events are enabled at runtime
+ * with the trace monitor command.
+ *
+ * An enabled tracepoint writes a fixed size binary record (TSC, event,
+ * two arguments) into the ring of the current CPU. Each CPU only writes
+ * its own ring, so there are no locks; the ring keeps the newest
+ * TRACE_RECORDS records and counts the overwritten ones. Records are
+ * decoded afterwards, merged by TSC across CPUs, see trace_iter_next().
+ *
+ * trace_export() prints the records as Chrome trace event JSON on the
+ * serial port, to be cut out of the qemu log by trace-extract and opened
+ * in chrome://tracing or Perfetto.
+ *
+ * These are independent of the compile-time trace_* switches in
+ * traceopt.h, which still print with cprintf().
+ */
+
+#define TRACE_RECORDS 4096 /* per CPU, power of two */
+
+/* X(id, name, arg0 name, arg1 name), NULL names unused arguments.
+ * STAGE, FRAME and GPU_CMD have the TSC their span started at as arg1. */
+#define TRACE_EVENTS(X)                            \
+    X(TRAP, "trap", "trapno", "rip")               \
+    X(ENV_ALLOC, "env_alloc", "env", "parent")     \
+    X(ENV_FREE, "env_free", "env", NULL)           \
+    X(ENV_RUN, "env_run", "env", "rip")            \
+    X(PAGE_ALLOC, "page_alloc", "pa", "class")     \
+    X(KEY, "key", "key", "down")                   \
+    X(STAGE, "stage", "stage", "start")            \
+    X(FRAME, "frame", "frame", "start")            \
+    X(GPU_CMD, "gpu_cmd", "cmd", "start")
+
+enum trace_event {
+#define TRACE_ENUM(id, name, arg0, arg1) TRACE_##id,
+    TRACE_EVENTS(TRACE_ENUM)
+#undef TRACE_ENUM
+    TRACE_NEVENTS,
+};
+
+struct trace_record {
+    uint64_t tsc;
+    uint16_t event;
+    uint16_t cpu;
+    uint32_t reserved;
+    uint64_t args[2];
+};
+
+/* Bit (1 << event) enables the event */
+extern uint64_t trace_mask;
+
+#define TRACE_ALL ((1ULL << TRACE_NEVENTS) - 1)
+
+void trace_emit(enum trace_event event, uint64_t arg0, uint64_t arg1);
+
+#define TRACE(id, arg0, arg1)                                                        \
+    do {                                                                             \
+        if (__builtin_expect(trace_mask & (1ULL << TRACE_##id), 0))                  \
+            trace_emit(TRACE_##id, (uint64_t)(arg0), (uint64_t)(arg1));              \
+    } while (0)
+
+const char *trace_event_name(enum trace_event event);
+/* NULL if the event doesn't use the argument */
+const char *trace_arg_name(enum trace_event event, int arg);
+/* -1 if there is no such event */
+int trace_event_parse(const char *name);
+
+/* Records written and overwritten, summed over CPUs */
+void trace_stats(uint64_t *written, uint64_t *lost);
+void trace_clear(void);
+
+/* Walks the records left in all rings, oldest first */
+struct trace_iter {
+    uint64_t pos[NCPU];
+};
+
+void trace_iter_begin(struct trace_iter *iter);
+const struct trace_record *trace_iter_next(struct trace_iter *iter);
+
+/* "trace: <us> cpu=<n> <event> <arg>=<value> ..." for the last max records (all if 0) */
+void trace_dump(uint32_t max);
+
+/* Chrome trace event JSON between "trace-json: begin" and "trace-json: end"
+ * lines, serial only. A trap is a span until the next env_run and an env
+ * run is a span until the next trap on that CPU, other events are instants. */
+void trace_export(void);
@@ -10,6 +10,8 @@
 #include <kern/env.h>
 #include <kern/sched.h>
 #include <kern/kclock.h>
+#include <kern/klog.h>
+#include <kern/trace.h>
 #include <kern/picirq.h>
 #include <kern/timer.h>
 #include <kern/traceopt.h>
@@ -96,12 +98,22 @@ trapname(int trapno) {
 
 void
 trap_init(void) {
+    /* CPU exceptions, see exception_thdlrs in trapentry.S */
+    extern void (*const exception_thdlrs[32])();
+    for (int i = 0; i < 32; i++) {
+        idt[i] = GATE(0, GD_KT, exception_thdlrs[i], 0);
+    }
+    idt[T_DBLFLT].gd_ist = 2;
     // LAB 4: Your code here
     extern void clock_thdlr();
     idt[IRQ_OFFSET + IRQ_CLOCK] = GATE(0, GD_KT, &clock_thdlr, 0);
     // LAB 5: Your code here
     extern void timer_thdlr();
     idt[IRQ_OFFSET + IRQ_TIMER] = GATE(0, GD_KT, &timer_thdlr, 0);
+    /* Page faults switch to their own stack, see pgflt_thdlr */
+    extern void pgflt_thdlr();
+    idt[T_PGFLT] = GATE(0, GD_KT, &pgflt_thdlr, 0);
+    idt[T_PGFLT].gd_ist = 1;
     /* Per-CPU setup */
     trap_init_percpu();
 }
@@ -137,7 +149,8 @@ trap_init_percpu(void) {
     /* Setup a TSS so that we get the right stack
      * when we trap to the kernel. */
     ts.ts_rsp0 = KERN_STACK_TOP;
-    ts.ts_ist1 = KERN_PF_STACK_TOP;
+    ts.ts_ist1 = (uintptr_t)pfstacktop;
+    ts.ts_ist2 = (uintptr_t)dfstacktop;
 
     /* Initialize the TSS slot of the gdt. */
     *(volatile struct Segdesc64 *)(&gdt[(GD_TSS0 >> 3)]) = SEG64_TSS(STS_T64A, ((uint64_t)&ts), sizeof(struct Taskstate), 0);
@@ -246,8 +259,9 @@ trap(struct Trapframe *tf) {
      * the interrupt path */
     assert(!(read_rflags() & FL_IF));
 
-    if (trace_traps) cprintf("Incoming TRAP[%ld] frame at %p\n", tf->tf_trapno, tf);
+    if (trace_traps) klog(KLOG_DEBUG, "Incoming TRAP[%ld] frame at %p\n", tf->tf_trapno, tf);
     if (trace_traps_more) print_trapframe(tf);
+    TRACE(TRAP, tf->tf_trapno, tf->tf_rip);
 
     assert(curenv);
 
@@ -273,3 +287,33 @@ trap(struct Trapframe *tf) {
     else
         sched_yield();
 }
+
+/* Called by the exception stubs in trapentry.S. Exceptions from user mode
+ * go through trap() and destroy the environment, the kernel can't recover
+ * from its own ones. */
+_Noreturn void
+exception_handler(struct Trapframe *tf) {
+    if ((tf->tf_cs & 3) && curenv) trap(tf);
+
+    last_tf = tf;
+    print_trapframe(tf);
+    panic("Unhandled exception %ld in kernel", (long)tf->tf_trapno);
+}
+
+/* Called by pgflt_thdlr, returning retries the faulting instruction.
+ * Unresolved faults from user mode destroy the environment like any
+ * other exception, only kernel mode ones panic. */
+void
+page_fault_handler(struct Trapframe *tf) {
+    uintptr_t va = rcr2();
+
+    /* First write to a lazy mapping */
+    if ((tf->tf_err & (FEC_P | FEC_W)) == (FEC_P | FEC_W) &&
+        !force_alloc_page(current_space, va, MAX_ALLOCATION_CLASS)) return;
+
+    if ((tf->tf_cs & 3) && curenv) trap(tf);
+
+    last_tf = tf;
+    print_trapframe(tf);
+    panic("Unhandled page fault at va %p", (void *)va);
+}
@@ -20,5 +20,7 @@ void trap_init(void);
 void trap_init_percpu(void);
 void print_regs(struct PushRegs *regs);
 void print_trapframe(struct Trapframe *tf);
+void page_fault_handler(struct Trapframe *tf);
+_Noreturn void exception_handler(struct Trapframe *tf);
 
 #endif /* JOS_KERN_TRAP_H */
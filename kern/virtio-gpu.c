@@ -6,6 +6,8 @@
 #include <kern/pci.bits.h>
 #include <inc/string.h>
 #include "graphic.h"
+#include "profiler.h"
+#include "trace.h"
 
 bool VIRTIO_DEBUG_INFO = false;
 
@@ -351,12 +353,14 @@ send_and_recieve(struct virtq *queue, void *to_send, uint64_t send_size, void *t
 
     atomic_fence();
 
+    uint64_t start = read_tsc();
     queue_avail(queue, 2);
     notify_queue(queue);
 
     while (!((struct virtio_gpu_ctrl_hdr *)to_recieve)->type) {
         asm volatile("pause");
     }
+    TRACE(GPU_CMD, ((struct virtio_gpu_ctrl_hdr *)to_send)->type, start);
     irq_handler();
 }
 
@@ -405,7 +409,7 @@ resource_create_2d(struct surface_t *surface) {
             .hdr.type    = VIRTIO_GPU_CMD_RESOURCE_CREATE_2D,
             .height      = surface->height,
             .width       = surface->width,
-            .format      = VIRTIO_GPU_FORMAT_X8R8G8B8_UNORM,
+            .format      = pixfmt_virtio_format(surface->format),
             .resource_id = surface->resource_id
     };
 
@@ -426,6 +430,15 @@ resource_create_2d(struct surface_t *surface) {
 }
 
 
+/* Surfaces with a non-native host format are converted here right before
+ * each transfer. Transfers are synchronous, so one buffer serves all of them. */
+static uint32_t host_staging[MAX_WINDOW_WIDTH * MAX_WINDOW_HEIGHT];
+
+static void *
+surface_backing(struct surface_t *surface) {
+    return surface->format == PIXFMT_NATIVE ? (void *)surface->backbuf : (void *)host_staging;
+}
+
 static int
 attach_backing(struct surface_t *surface) {
     // Allocate a surface from guest ram, and attach it as backing storage to the resource just created,
@@ -448,8 +461,8 @@ attach_backing(struct surface_t *surface) {
     struct virtio_gpu_mem_entry *mem_entries =
             (struct virtio_gpu_mem_entry *)(backing_cmd + 1);
 
-    mem_entries->addr = (uint64_t)PADDR(surface->backbuf); /*backbuf phys addr*/
-    mem_entries->length = surface->width * surface->height * sizeof(uint32_t);
+    mem_entries->addr = (uint64_t)PADDR(surface_backing(surface)); /*backbuf phys addr*/
+    mem_entries->length = surface->width * surface->height * pixfmt_size(surface->format);
 
     send_and_recieve(&gpu.controlq, backing_cmd, backing_cmd_sz,
                      &res, sizeof(res));
@@ -536,9 +549,11 @@ set_scanout(struct surface_t *surface) {
 static int
 transfer_to_host_2D(struct surface_t *surface, rect_t *rect) {
     // Use VIRTIO_GPU_CMD_TRANSFER_TO_HOST_2D to update the host resource from guest memory.
+    // Offset is where the rect starts in the backing storage.
     struct virtio_gpu_transfer_to_host_2d transfer = {
             .hdr.type = VIRTIO_GPU_CMD_TRANSFER_TO_HOST_2D,
             .r = *rect,
+            .offset = ((uint64_t)rect->y * surface->width + rect->x) * pixfmt_size(surface->format),
             .resource_id = surface->resource_id};
     struct virtio_gpu_ctrl_hdr res = {};
 
@@ -580,9 +595,39 @@ flush(struct surface_t *surface, rect_t *rect) {
 
 void
 surface_init(struct surface_t *surface, uint32_t buf_w, uint32_t buf_h) {
+    surface_init_format(surface, buf_w, buf_h, surface_host_format);
+}
+
+void
+surface_init_offscreen(struct surface_t *surface, uint32_t buf_w, uint32_t buf_h) {
+    surface->resource_id = 0;
+    surface->width  = buf_w ? MIN(buf_w, MAX_WINDOW_WIDTH) : MAX_WINDOW_WIDTH;
+    surface->height = buf_h ? MIN(buf_h, MAX_WINDOW_HEIGHT) : MAX_WINDOW_HEIGHT;
+    surface->format = PIXFMT_NATIVE;
+    surface->frames = 0;
+    surface_set_clip(surface, NULL);
+}
+
+bool
+surface_is_offscreen(const struct surface_t *surface) {
+    return !surface->resource_id;
+}
+
+void
+surface_init_format(struct surface_t *surface, uint32_t buf_w, uint32_t buf_h, enum pixel_format format) {
+    assert(pixfmt_virtio_format(format));
+
+    if (gfx_headless || !gpu.screen_w) {
+        surface_init_offscreen(surface, buf_w, buf_h);
+        return;
+    }
+
     surface->resource_id = ++gpu.resource_id_cnt; // so we start from 1
     surface->width  = buf_w;
     surface->height = buf_h;
+    surface->format = format;
+    surface->frames = 0;
+    surface_set_clip(surface, NULL);
 
     resource_create_2d(surface);
     attach_backing(surface);
@@ -602,21 +647,49 @@ surface_update_rect(struct surface_t *surface, uint32_t x, uint32_t y, uint32_t
         height = surface->height;
     }
 
+    if (surface_is_offscreen(surface)) {
+        return;
+    }
+
     if (gpu.last_scanout_id != surface->resource_id) { 
         set_scanout(surface);
         gpu.last_scanout_id = surface->resource_id;
     }
 
-    rect_t rect = {0, 0, width, height};
+    if (x >= surface->width || y >= surface->height) {
+        return;
+    }
+
+    rect_t rect = {x, y, MIN(width, surface->width - x), MIN(height, surface->height - y)};
+
+    uint64_t t = prof_start();
+    if (surface->format != PIXFMT_NATIVE) {
+        size_t pixel_size = pixfmt_size(surface->format);
+        for (uint32_t row = rect.y; row < rect.y + rect.height; row++) {
+            size_t offset = row * surface->width + rect.x;
+            pixfmt_from_native((char *)host_staging + offset * pixel_size, surface->format,
+                               surface->backbuf + offset, rect.width);
+        }
+    }
+
+    prof_stop(PROF_CONVERT, t);
 
     // update host surface
+    t = prof_start();
     transfer_to_host_2D(surface, &rect);
+    prof_stop(PROF_TRANSFER, t);
+
     // flush to window
+    t = prof_start();
     flush(surface, &rect);
+    prof_stop(PROF_FLUSH, t);
 }
 
 void
 surface_destroy(struct surface_t *surface) {
+    if (surface_is_offscreen(surface)) {
+        return;
+    }
     detach_backing(surface->resource_id);
     resource_unref(surface->resource_id);
 }
@@ -31,27 +31,44 @@ static const char *const error_string[MAXERROR] = {
         [E_NO_SYS] = "no such system call",
 };
 
+/* "00" .. "99", so decimal numbers are converted two digits per division */
+static const char digit_pairs[] =
+        "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+        "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+        "8081828384858687888990919293949596979899";
+
 /*
- * Print a number (base <= 16) in reverse order,
- * using specified putch function and associated pointer putdat.
+ * Convert a number (base 8, 10 or 16) to digits ending right before end,
+ * returns the start of the digits.
  */
-static void
-print_num(void (*putch)(int, void *), void *put_arg,
-          uintmax_t num, unsigned base, int width, char padc, bool capital) {
-    /* First recursively print all preceding (more significant) digits */
-    if (num >= base) {
-        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
-    } else {
-        /* Print any needed pad characters before first digit */
-        while (--width > 0) {
-            putch(padc, put_arg);
+static char *
+format_num(char *end, uintmax_t num, unsigned base, bool capital) {
+    char *ptr = end;
+
+    if (base == 10) {
+        while (num >= 100) {
+            const char *pair = digit_pairs + (num % 100) * 2;
+            num /= 100;
+            *--ptr = pair[1];
+            *--ptr = pair[0];
         }
+        if (num >= 10) {
+            *--ptr = digit_pairs[num * 2 + 1];
+            *--ptr = digit_pairs[num * 2];
+        } else {
+            *--ptr = '0' + num;
+        }
+        return ptr;
     }
 
     const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+    unsigned shift = base == 16 ? 4 : 3;
+    do {
+        *--ptr = dig[num & (base - 1)];
+        num >>= shift;
+    } while (num);
 
-    /* Then print this (the least significant) digit */
-    putch(dig[num % base], put_arg);
+    return ptr;
 }
 
 /* Get an unsigned int of various possible sizes from a varargs list,
@@ -86,22 +103,89 @@ get_int(va_list *ap, int lflag, bool zflag) {
     }
 }
 
-/* Main function to format and print a string. */
-void printfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, ...);
+/* Output helpers, buf is handed to flush() whenever it fills up.
+ * Without flush() the rest of the output is only counted. */
 
-void
-vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+static void
+fmt_flush(struct fmtbuf *out) {
+    if (!out->flush) return;
+
+    if (out->pos) out->flush(out);
+    out->pos = 0;
+}
+
+static void
+fmt_write(struct fmtbuf *out, const char *str, size_t len) {
+    out->count += len;
+
+    while (len) {
+        if (out->pos == out->size) {
+            if (!out->flush) return;
+            fmt_flush(out);
+        }
+
+        size_t n = MIN(len, out->size - out->pos);
+        memcpy(out->buf + out->pos, str, n);
+        out->pos += n;
+        str += n;
+        len -= n;
+    }
+}
+
+static void
+fmt_fill(struct fmtbuf *out, char ch, int len) {
+    if (len <= 0) return;
+    out->count += len;
+
+    while (len) {
+        if (out->pos == out->size) {
+            if (!out->flush) return;
+            fmt_flush(out);
+        }
+
+        size_t n = MIN((size_t)len, out->size - out->pos);
+        memset(out->buf + out->pos, ch, n);
+        out->pos += n;
+        len -= n;
+    }
+}
+
+static inline void
+fmt_putc(struct fmtbuf *out, char ch) {
+    if (out->pos == out->size && out->flush) {
+        fmt_flush(out);
+    }
+    if (out->pos < out->size) {
+        out->buf[out->pos++] = ch;
+    }
+    out->count++;
+}
+
+/* Digits padded on the left with padc up to width */
+static void
+fmt_num(struct fmtbuf *out, uintmax_t num, unsigned base, int width, char padc, bool capital) {
+    char digits[24];
+    char *end = digits + sizeof(digits);
+    char *start = format_num(end, num, base, capital);
+
+    fmt_fill(out, padc, width - (end - start));
+    fmt_write(out, start, end - start);
+}
+
+/* Main function to format a string. */
+int
+vbprintfmt(struct fmtbuf *out, const char *fmt, va_list ap) {
     const unsigned char *ufmt = (unsigned char *)fmt;
 
     va_list aq;
     va_copy(aq, ap);
 
     for (;;) {
-        unsigned char ch;
-        while ((ch = *ufmt++) != '%') {
-            if (!ch) return;
-            putch(ch, put_arg);
-        }
+        /* Copy the literal text up to the next escape in one go */
+        const unsigned char *text = ufmt;
+        while (*ufmt && *ufmt != '%') ufmt++;
+        fmt_write(out, (const char *)text, ufmt - text);
+        if (!*ufmt++) break;
 
         /* Process a %-escape sequence */
         char padc = ' ';
@@ -109,6 +193,7 @@ vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap
         unsigned lflag = 0, base = 10;
         bool altflag = 0, zflag = 0;
         uintmax_t num = 0;
+        unsigned char ch;
     reswitch:
 
         switch (ch = *ufmt++) {
@@ -159,7 +244,7 @@ vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap
             goto reswitch;
 
         case 'c': /* character */
-            putch(va_arg(aq, int), put_arg);
+            fmt_putc(out, va_arg(aq, int));
             break;
 
         case 'i': /* error message */ {
@@ -169,9 +254,10 @@ vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap
             if (err < 0) err = -err;
 
             if (err >= MAXERROR || !(strerr = error_string[err])) {
-                printfmt(putch, put_arg, "error %d", err);
+                fmt_write(out, "error ", 6);
+                fmt_num(out, err, 10, -1, ' ', 0);
             } else {
-                printfmt(putch, put_arg, "%s", strerr);
+                fmt_write(out, strerr, strlen(strerr));
             }
             break;
         }
@@ -180,24 +266,26 @@ vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap
             const char *ptr = va_arg(aq, char *);
             if (!ptr) ptr = "(null)";
 
-            if (width > 0 && padc != '-') {
-                width -= strnlen(ptr, precision);
+            int len = strnlen(ptr, precision);
 
-                while (width-- > 0) putch(padc, put_arg);
-            }
+            if (padc != '-') fmt_fill(out, padc, width - len);
 
-            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
-                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+            if (altflag) {
+                for (int i = 0; i < len; i++) {
+                    fmt_putc(out, ptr[i] < ' ' || ptr[i] > '~' ? '?' : ptr[i]);
+                }
+            } else {
+                fmt_write(out, ptr, len);
             }
 
-            while (width-- > 0) putch(' ', put_arg);
+            if (padc == '-') fmt_fill(out, ' ', width - len);
             break;
         }
 
         case 'd': /* (signed) decimal */ {
             intmax_t i = get_int(&aq, lflag, zflag);
             if (i < 0) {
-                putch('-', put_arg);
+                fmt_putc(out, '-');
                 i = -i;
             }
             num = i;
@@ -217,8 +305,7 @@ vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap
             goto number;
 
         case 'p': /* pointer */
-            putch('0', put_arg);
-            putch('x', put_arg);
+            fmt_write(out, "0x", 2);
             num = (uintptr_t)va_arg(aq, void *);
             base = 16;
             goto number;
@@ -228,19 +315,48 @@ vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap
             num = get_unsigned(&aq, lflag, zflag);
             base = 16;
         number:
-            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+            fmt_num(out, num, base, width, padc, ch == 'X');
             break;
 
         case '%': /* escaped '%' character */
-            putch(ch, put_arg);
+            fmt_putc(out, ch);
             break;
 
         default: /* unrecognized escape sequence - just print it literally */
-            putch('%', put_arg);
+            fmt_putc(out, '%');
             while ((--ufmt)[-1] != '%') /* nothing */
                 ;
         }
     }
+
+    va_end(aq);
+    fmt_flush(out);
+    return out->count;
+}
+
+/* putch() based interface on top of vbprintfmt() */
+
+struct putch_arg {
+    void (*putch)(int, void *);
+    void *put_arg;
+};
+
+static void
+putch_flush(struct fmtbuf *out) {
+    struct putch_arg *arg = out->arg;
+
+    for (size_t i = 0; i < out->pos; i++) {
+        arg->putch((unsigned char)out->buf[i], arg->put_arg);
+    }
+}
+
+void
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+    char buf[64];
+    struct putch_arg arg = {putch, put_arg};
+    struct fmtbuf out = {.buf = buf, .size = sizeof(buf), .flush = putch_flush, .arg = &arg};
+
+    vbprintfmt(&out, fmt, ap);
 }
 
 void
@@ -252,33 +368,16 @@ printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
     va_end(ap);
 }
 
-struct sprintbuf {
-    char *start;
-    char *end;
-    int count;
-};
-
-static void
-sprintputch(int ch, struct sprintbuf *state) {
-    state->count++;
-    if (state->start < state->end) {
-        *state->start++ = ch;
-    }
-}
-
 int
 vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
-    struct sprintbuf state = {buf, buf + n - 1, 0};
-
     if (!buf || n < 1) return -E_INVAL;
 
-    /* Print the string to the buffer */
-    vprintfmt((void *)sprintputch, &state, fmt, ap);
-
-    /* Null terminate the buffer */
-    *state.start = '\0';
+    /* Leave room for the terminating null, output past it is only counted */
+    struct fmtbuf out = {.buf = buf, .size = n - 1};
+    int count = vbprintfmt(&out, fmt, ap);
+    buf[out.pos] = '\0';
 
-    return state.count;
+    return count;
 }
 
 int
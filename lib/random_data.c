@@ -0,0 +1,12 @@
+unsigned char _dev_urandom[] = {
+  0x14, 0x13, 0x74, 0x9c, 0x93, 0xa9, 0x07, 0x21, 0xe9, 0xeb, 0x54, 0x46,
+  0x3b, 0x3a, 0x1e, 0x12, 0xb0, 0x35, 0x28, 0xb3, 0x6b, 0xa7, 0xf6, 0xb8,
+  0x28, 0x82, 0xdb, 0x08, 0x49, 0x7e, 0xc2, 0xe1, 0x12, 0xaa, 0x1c, 0xaa,
+  0xa8, 0x65, 0xd4, 0xf5, 0x45, 0x00, 0xa1, 0xd3, 0x11, 0xe8, 0xa0, 0xff,
+  0x17, 0xa1, 0x76, 0x99, 0x92, 0xb7, 0xaf, 0xde, 0xa5, 0x73, 0x0b, 0x8d,
+  0x7d, 0x84, 0xe5, 0xb1, 0xb7, 0x78, 0x4a, 0x5f, 0x76, 0xd5, 0xc7, 0xb3,
+  0xbf, 0x78, 0xa6, 0xfb, 0x39, 0x92, 0xe4, 0xd8, 0x28, 0xcc, 0xce, 0x84,
+  0x16, 0xc3, 0xcd, 0x1c, 0x8a, 0x1f, 0xe2, 0x6e, 0x2a, 0xbb, 0x01, 0xc3,
+  0xce, 0x58, 0x7c, 0x57
+};
+unsigned int _dev_urandom_len = 100;
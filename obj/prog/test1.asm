@@ -0,0 +1,899 @@
+
+obj/prog/test1:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000001000000 <_start>:
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+ 1000000:	6a 00                	push   $0x0
+    pushq $0
+ 1000002:	6a 00                	push   $0x0
+
+0000000001000004 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+ 1000004:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+ 1000009:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+ 100000d:	31 ed                	xor    %ebp,%ebp
+    call libmain
+ 100000f:	e8 32 00 00 00       	call   1000046 <libmain>
+    jmp .
+ 1000014:	eb fe                	jmp    1000014 <args_exist+0x10>
+
+0000000001000016 <umain>:
+void (*volatile sys_yield)(void);
+
+void
+umain(int argc, char **argv) {
+ 1000016:	55                   	push   %rbp
+ 1000017:	48 89 e5             	mov    %rsp,%rbp
+ 100001a:	41 54                	push   %r12
+ 100001c:	53                   	push   %rbx
+ 100001d:	bb 03 00 00 00       	mov    $0x3,%ebx
+    int i, j;
+
+    for (j = 0; j < 3; ++j) {
+        for (i = 0; i < 10000; ++i)
+            ;
+        sys_yield();
+ 1000022:	49 bc 08 10 00 01 00 	movabs $0x1001008,%r12
+ 1000029:	00 00 00 
+umain(int argc, char **argv) {
+ 100002c:	b8 10 27 00 00       	mov    $0x2710,%eax
+        for (i = 0; i < 10000; ++i)
+ 1000031:	83 e8 01             	sub    $0x1,%eax
+ 1000034:	75 fb                	jne    1000031 <umain+0x1b>
+        sys_yield();
+ 1000036:	49 8b 04 24          	mov    (%r12),%rax
+ 100003a:	ff d0                	call   *%rax
+    for (j = 0; j < 3; ++j) {
+ 100003c:	83 eb 01             	sub    $0x1,%ebx
+ 100003f:	75 eb                	jne    100002c <umain+0x16>
+    }
+}
+ 1000041:	5b                   	pop    %rbx
+ 1000042:	41 5c                	pop    %r12
+ 1000044:	5d                   	pop    %rbp
+ 1000045:	c3                   	ret
+
+0000000001000046 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+ 1000046:	55                   	push   %rbp
+ 1000047:	48 89 e5             	mov    %rsp,%rbp
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+ 100004a:	85 ff                	test   %edi,%edi
+ 100004c:	7e 0d                	jle    100005b <libmain+0x15>
+ 100004e:	48 8b 06             	mov    (%rsi),%rax
+ 1000051:	48 a3 00 10 00 01 00 	movabs %rax,0x1001000
+ 1000058:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+ 100005b:	48 b8 16 00 00 01 00 	movabs $0x1000016,%rax
+ 1000062:	00 00 00 
+ 1000065:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+ 1000067:	48 a1 10 10 00 01 00 	movabs 0x1001010,%rax
+ 100006e:	00 00 00 
+ 1000071:	ff d0                	call   *%rax
+#endif
+}
+ 1000073:	5d                   	pop    %rbp
+ 1000074:	c3                   	ret
+ 1000075:	0f 1f 00             	nopl   (%rax)
+ 1000078:	3c 75                	cmp    $0x75,%al
+ 100007a:	6e                   	outsb  %ds:(%rsi),(%dx)
+ 100007b:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+ 100007f:	6e                   	outsb  %ds:(%rsi),(%dx)
+ 1000080:	3e 00 66 2e          	ds add %ah,0x2e(%rsi)
+ 1000084:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+ 100008b:	00 
+ 100008c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000093:	00 00 00 
+ 1000096:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 100009d:	00 00 00 
+ 10000a0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10000a7:	00 00 00 
+ 10000aa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10000b1:	00 00 00 
+ 10000b4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10000bb:	00 00 00 
+ 10000be:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10000c5:	00 00 00 
+ 10000c8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10000cf:	00 00 00 
+ 10000d2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10000d9:	00 00 00 
+ 10000dc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10000e3:	00 00 00 
+ 10000e6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10000ed:	00 00 00 
+ 10000f0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10000f7:	00 00 00 
+ 10000fa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000101:	00 00 00 
+ 1000104:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 100010b:	00 00 00 
+ 100010e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000115:	00 00 00 
+ 1000118:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 100011f:	00 00 00 
+ 1000122:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000129:	00 00 00 
+ 100012c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000133:	00 00 00 
+ 1000136:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 100013d:	00 00 00 
+ 1000140:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000147:	00 00 00 
+ 100014a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000151:	00 00 00 
+ 1000154:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 100015b:	00 00 00 
+ 100015e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000165:	00 00 00 
+ 1000168:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 100016f:	00 00 00 
+ 1000172:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000179:	00 00 00 
+ 100017c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000183:	00 00 00 
+ 1000186:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 100018d:	00 00 00 
+ 1000190:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000197:	00 00 00 
+ 100019a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10001a1:	00 00 00 
+ 10001a4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10001ab:	00 00 00 
+ 10001ae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10001b5:	00 00 00 
+ 10001b8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10001bf:	00 00 00 
+ 10001c2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10001c9:	00 00 00 
+ 10001cc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10001d3:	00 00 00 
+ 10001d6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10001dd:	00 00 00 
+ 10001e0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10001e7:	00 00 00 
+ 10001ea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10001f1:	00 00 00 
+ 10001f4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10001fb:	00 00 00 
+ 10001fe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000205:	00 00 00 
+ 1000208:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 100020f:	00 00 00 
+ 1000212:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000219:	00 00 00 
+ 100021c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000223:	00 00 00 
+ 1000226:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 100022d:	00 00 00 
+ 1000230:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000237:	00 00 00 
+ 100023a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000241:	00 00 00 
+ 1000244:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 100024b:	00 00 00 
+ 100024e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000255:	00 00 00 
+ 1000258:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 100025f:	00 00 00 
+ 1000262:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000269:	00 00 00 
+ 100026c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000273:	00 00 00 
+ 1000276:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 100027d:	00 00 00 
+ 1000280:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000287:	00 00 00 
+ 100028a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000291:	00 00 00 
+ 1000294:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 100029b:	00 00 00 
+ 100029e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10002a5:	00 00 00 
+ 10002a8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10002af:	00 00 00 
+ 10002b2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10002b9:	00 00 00 
+ 10002bc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10002c3:	00 00 00 
+ 10002c6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10002cd:	00 00 00 
+ 10002d0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10002d7:	00 00 00 
+ 10002da:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10002e1:	00 00 00 
+ 10002e4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10002eb:	00 00 00 
+ 10002ee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10002f5:	00 00 00 
+ 10002f8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10002ff:	00 00 00 
+ 1000302:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000309:	00 00 00 
+ 100030c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000313:	00 00 00 
+ 1000316:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 100031d:	00 00 00 
+ 1000320:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000327:	00 00 00 
+ 100032a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000331:	00 00 00 
+ 1000334:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 100033b:	00 00 00 
+ 100033e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000345:	00 00 00 
+ 1000348:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 100034f:	00 00 00 
+ 1000352:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000359:	00 00 00 
+ 100035c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000363:	00 00 00 
+ 1000366:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 100036d:	00 00 00 
+ 1000370:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000377:	00 00 00 
+ 100037a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000381:	00 00 00 
+ 1000384:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 100038b:	00 00 00 
+ 100038e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000395:	00 00 00 
+ 1000398:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 100039f:	00 00 00 
+ 10003a2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10003a9:	00 00 00 
+ 10003ac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10003b3:	00 00 00 
+ 10003b6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10003bd:	00 00 00 
+ 10003c0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10003c7:	00 00 00 
+ 10003ca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10003d1:	00 00 00 
+ 10003d4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10003db:	00 00 00 
+ 10003de:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10003e5:	00 00 00 
+ 10003e8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10003ef:	00 00 00 
+ 10003f2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10003f9:	00 00 00 
+ 10003fc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000403:	00 00 00 
+ 1000406:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 100040d:	00 00 00 
+ 1000410:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000417:	00 00 00 
+ 100041a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000421:	00 00 00 
+ 1000424:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 100042b:	00 00 00 
+ 100042e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000435:	00 00 00 
+ 1000438:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 100043f:	00 00 00 
+ 1000442:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000449:	00 00 00 
+ 100044c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000453:	00 00 00 
+ 1000456:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 100045d:	00 00 00 
+ 1000460:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000467:	00 00 00 
+ 100046a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000471:	00 00 00 
+ 1000474:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 100047b:	00 00 00 
+ 100047e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000485:	00 00 00 
+ 1000488:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 100048f:	00 00 00 
+ 1000492:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000499:	00 00 00 
+ 100049c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10004a3:	00 00 00 
+ 10004a6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10004ad:	00 00 00 
+ 10004b0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10004b7:	00 00 00 
+ 10004ba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10004c1:	00 00 00 
+ 10004c4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10004cb:	00 00 00 
+ 10004ce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10004d5:	00 00 00 
+ 10004d8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10004df:	00 00 00 
+ 10004e2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10004e9:	00 00 00 
+ 10004ec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10004f3:	00 00 00 
+ 10004f6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10004fd:	00 00 00 
+ 1000500:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000507:	00 00 00 
+ 100050a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000511:	00 00 00 
+ 1000514:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 100051b:	00 00 00 
+ 100051e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000525:	00 00 00 
+ 1000528:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 100052f:	00 00 00 
+ 1000532:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000539:	00 00 00 
+ 100053c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000543:	00 00 00 
+ 1000546:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 100054d:	00 00 00 
+ 1000550:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000557:	00 00 00 
+ 100055a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000561:	00 00 00 
+ 1000564:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 100056b:	00 00 00 
+ 100056e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000575:	00 00 00 
+ 1000578:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 100057f:	00 00 00 
+ 1000582:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000589:	00 00 00 
+ 100058c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000593:	00 00 00 
+ 1000596:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 100059d:	00 00 00 
+ 10005a0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10005a7:	00 00 00 
+ 10005aa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10005b1:	00 00 00 
+ 10005b4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10005bb:	00 00 00 
+ 10005be:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10005c5:	00 00 00 
+ 10005c8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10005cf:	00 00 00 
+ 10005d2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10005d9:	00 00 00 
+ 10005dc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10005e3:	00 00 00 
+ 10005e6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10005ed:	00 00 00 
+ 10005f0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10005f7:	00 00 00 
+ 10005fa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000601:	00 00 00 
+ 1000604:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 100060b:	00 00 00 
+ 100060e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000615:	00 00 00 
+ 1000618:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 100061f:	00 00 00 
+ 1000622:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000629:	00 00 00 
+ 100062c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000633:	00 00 00 
+ 1000636:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 100063d:	00 00 00 
+ 1000640:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000647:	00 00 00 
+ 100064a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000651:	00 00 00 
+ 1000654:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 100065b:	00 00 00 
+ 100065e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000665:	00 00 00 
+ 1000668:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 100066f:	00 00 00 
+ 1000672:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000679:	00 00 00 
+ 100067c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000683:	00 00 00 
+ 1000686:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 100068d:	00 00 00 
+ 1000690:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000697:	00 00 00 
+ 100069a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10006a1:	00 00 00 
+ 10006a4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10006ab:	00 00 00 
+ 10006ae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10006b5:	00 00 00 
+ 10006b8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10006bf:	00 00 00 
+ 10006c2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10006c9:	00 00 00 
+ 10006cc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10006d3:	00 00 00 
+ 10006d6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10006dd:	00 00 00 
+ 10006e0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10006e7:	00 00 00 
+ 10006ea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10006f1:	00 00 00 
+ 10006f4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10006fb:	00 00 00 
+ 10006fe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000705:	00 00 00 
+ 1000708:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 100070f:	00 00 00 
+ 1000712:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000719:	00 00 00 
+ 100071c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000723:	00 00 00 
+ 1000726:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 100072d:	00 00 00 
+ 1000730:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000737:	00 00 00 
+ 100073a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000741:	00 00 00 
+ 1000744:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 100074b:	00 00 00 
+ 100074e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000755:	00 00 00 
+ 1000758:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 100075f:	00 00 00 
+ 1000762:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000769:	00 00 00 
+ 100076c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000773:	00 00 00 
+ 1000776:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 100077d:	00 00 00 
+ 1000780:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000787:	00 00 00 
+ 100078a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000791:	00 00 00 
+ 1000794:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 100079b:	00 00 00 
+ 100079e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10007a5:	00 00 00 
+ 10007a8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10007af:	00 00 00 
+ 10007b2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10007b9:	00 00 00 
+ 10007bc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10007c3:	00 00 00 
+ 10007c6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10007cd:	00 00 00 
+ 10007d0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10007d7:	00 00 00 
+ 10007da:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10007e1:	00 00 00 
+ 10007e4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10007eb:	00 00 00 
+ 10007ee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10007f5:	00 00 00 
+ 10007f8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10007ff:	00 00 00 
+ 1000802:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000809:	00 00 00 
+ 100080c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000813:	00 00 00 
+ 1000816:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 100081d:	00 00 00 
+ 1000820:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000827:	00 00 00 
+ 100082a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000831:	00 00 00 
+ 1000834:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 100083b:	00 00 00 
+ 100083e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000845:	00 00 00 
+ 1000848:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 100084f:	00 00 00 
+ 1000852:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000859:	00 00 00 
+ 100085c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000863:	00 00 00 
+ 1000866:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 100086d:	00 00 00 
+ 1000870:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000877:	00 00 00 
+ 100087a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000881:	00 00 00 
+ 1000884:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 100088b:	00 00 00 
+ 100088e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000895:	00 00 00 
+ 1000898:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 100089f:	00 00 00 
+ 10008a2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10008a9:	00 00 00 
+ 10008ac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10008b3:	00 00 00 
+ 10008b6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10008bd:	00 00 00 
+ 10008c0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10008c7:	00 00 00 
+ 10008ca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10008d1:	00 00 00 
+ 10008d4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10008db:	00 00 00 
+ 10008de:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10008e5:	00 00 00 
+ 10008e8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10008ef:	00 00 00 
+ 10008f2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10008f9:	00 00 00 
+ 10008fc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000903:	00 00 00 
+ 1000906:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 100090d:	00 00 00 
+ 1000910:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000917:	00 00 00 
+ 100091a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000921:	00 00 00 
+ 1000924:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 100092b:	00 00 00 
+ 100092e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000935:	00 00 00 
+ 1000938:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 100093f:	00 00 00 
+ 1000942:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000949:	00 00 00 
+ 100094c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000953:	00 00 00 
+ 1000956:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 100095d:	00 00 00 
+ 1000960:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000967:	00 00 00 
+ 100096a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000971:	00 00 00 
+ 1000974:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 100097b:	00 00 00 
+ 100097e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000985:	00 00 00 
+ 1000988:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 100098f:	00 00 00 
+ 1000992:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000999:	00 00 00 
+ 100099c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10009a3:	00 00 00 
+ 10009a6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10009ad:	00 00 00 
+ 10009b0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10009b7:	00 00 00 
+ 10009ba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10009c1:	00 00 00 
+ 10009c4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10009cb:	00 00 00 
+ 10009ce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10009d5:	00 00 00 
+ 10009d8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10009df:	00 00 00 
+ 10009e2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10009e9:	00 00 00 
+ 10009ec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10009f3:	00 00 00 
+ 10009f6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10009fd:	00 00 00 
+ 1000a00:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000a07:	00 00 00 
+ 1000a0a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000a11:	00 00 00 
+ 1000a14:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000a1b:	00 00 00 
+ 1000a1e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000a25:	00 00 00 
+ 1000a28:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000a2f:	00 00 00 
+ 1000a32:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000a39:	00 00 00 
+ 1000a3c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000a43:	00 00 00 
+ 1000a46:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000a4d:	00 00 00 
+ 1000a50:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000a57:	00 00 00 
+ 1000a5a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000a61:	00 00 00 
+ 1000a64:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000a6b:	00 00 00 
+ 1000a6e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000a75:	00 00 00 
+ 1000a78:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000a7f:	00 00 00 
+ 1000a82:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000a89:	00 00 00 
+ 1000a8c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000a93:	00 00 00 
+ 1000a96:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000a9d:	00 00 00 
+ 1000aa0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000aa7:	00 00 00 
+ 1000aaa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000ab1:	00 00 00 
+ 1000ab4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000abb:	00 00 00 
+ 1000abe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000ac5:	00 00 00 
+ 1000ac8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000acf:	00 00 00 
+ 1000ad2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000ad9:	00 00 00 
+ 1000adc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000ae3:	00 00 00 
+ 1000ae6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000aed:	00 00 00 
+ 1000af0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000af7:	00 00 00 
+ 1000afa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000b01:	00 00 00 
+ 1000b04:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000b0b:	00 00 00 
+ 1000b0e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000b15:	00 00 00 
+ 1000b18:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000b1f:	00 00 00 
+ 1000b22:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000b29:	00 00 00 
+ 1000b2c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000b33:	00 00 00 
+ 1000b36:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000b3d:	00 00 00 
+ 1000b40:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000b47:	00 00 00 
+ 1000b4a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000b51:	00 00 00 
+ 1000b54:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000b5b:	00 00 00 
+ 1000b5e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000b65:	00 00 00 
+ 1000b68:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000b6f:	00 00 00 
+ 1000b72:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000b79:	00 00 00 
+ 1000b7c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000b83:	00 00 00 
+ 1000b86:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000b8d:	00 00 00 
+ 1000b90:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000b97:	00 00 00 
+ 1000b9a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000ba1:	00 00 00 
+ 1000ba4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000bab:	00 00 00 
+ 1000bae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000bb5:	00 00 00 
+ 1000bb8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000bbf:	00 00 00 
+ 1000bc2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000bc9:	00 00 00 
+ 1000bcc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000bd3:	00 00 00 
+ 1000bd6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000bdd:	00 00 00 
+ 1000be0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000be7:	00 00 00 
+ 1000bea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000bf1:	00 00 00 
+ 1000bf4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000bfb:	00 00 00 
+ 1000bfe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000c05:	00 00 00 
+ 1000c08:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000c0f:	00 00 00 
+ 1000c12:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000c19:	00 00 00 
+ 1000c1c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000c23:	00 00 00 
+ 1000c26:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000c2d:	00 00 00 
+ 1000c30:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000c37:	00 00 00 
+ 1000c3a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000c41:	00 00 00 
+ 1000c44:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000c4b:	00 00 00 
+ 1000c4e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000c55:	00 00 00 
+ 1000c58:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000c5f:	00 00 00 
+ 1000c62:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000c69:	00 00 00 
+ 1000c6c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000c73:	00 00 00 
+ 1000c76:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000c7d:	00 00 00 
+ 1000c80:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000c87:	00 00 00 
+ 1000c8a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000c91:	00 00 00 
+ 1000c94:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000c9b:	00 00 00 
+ 1000c9e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000ca5:	00 00 00 
+ 1000ca8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000caf:	00 00 00 
+ 1000cb2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000cb9:	00 00 00 
+ 1000cbc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000cc3:	00 00 00 
+ 1000cc6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000ccd:	00 00 00 
+ 1000cd0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000cd7:	00 00 00 
+ 1000cda:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000ce1:	00 00 00 
+ 1000ce4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000ceb:	00 00 00 
+ 1000cee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000cf5:	00 00 00 
+ 1000cf8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000cff:	00 00 00 
+ 1000d02:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000d09:	00 00 00 
+ 1000d0c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000d13:	00 00 00 
+ 1000d16:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000d1d:	00 00 00 
+ 1000d20:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000d27:	00 00 00 
+ 1000d2a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000d31:	00 00 00 
+ 1000d34:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000d3b:	00 00 00 
+ 1000d3e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000d45:	00 00 00 
+ 1000d48:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000d4f:	00 00 00 
+ 1000d52:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000d59:	00 00 00 
+ 1000d5c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000d63:	00 00 00 
+ 1000d66:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000d6d:	00 00 00 
+ 1000d70:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000d77:	00 00 00 
+ 1000d7a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000d81:	00 00 00 
+ 1000d84:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000d8b:	00 00 00 
+ 1000d8e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000d95:	00 00 00 
+ 1000d98:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000d9f:	00 00 00 
+ 1000da2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000da9:	00 00 00 
+ 1000dac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000db3:	00 00 00 
+ 1000db6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000dbd:	00 00 00 
+ 1000dc0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000dc7:	00 00 00 
+ 1000dca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000dd1:	00 00 00 
+ 1000dd4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000ddb:	00 00 00 
+ 1000dde:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000de5:	00 00 00 
+ 1000de8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000def:	00 00 00 
+ 1000df2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000df9:	00 00 00 
+ 1000dfc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000e03:	00 00 00 
+ 1000e06:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000e0d:	00 00 00 
+ 1000e10:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000e17:	00 00 00 
+ 1000e1a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000e21:	00 00 00 
+ 1000e24:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000e2b:	00 00 00 
+ 1000e2e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000e35:	00 00 00 
+ 1000e38:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000e3f:	00 00 00 
+ 1000e42:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000e49:	00 00 00 
+ 1000e4c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000e53:	00 00 00 
+ 1000e56:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000e5d:	00 00 00 
+ 1000e60:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000e67:	00 00 00 
+ 1000e6a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000e71:	00 00 00 
+ 1000e74:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000e7b:	00 00 00 
+ 1000e7e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000e85:	00 00 00 
+ 1000e88:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000e8f:	00 00 00 
+ 1000e92:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000e99:	00 00 00 
+ 1000e9c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000ea3:	00 00 00 
+ 1000ea6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000ead:	00 00 00 
+ 1000eb0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000eb7:	00 00 00 
+ 1000eba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000ec1:	00 00 00 
+ 1000ec4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000ecb:	00 00 00 
+ 1000ece:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000ed5:	00 00 00 
+ 1000ed8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000edf:	00 00 00 
+ 1000ee2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000ee9:	00 00 00 
+ 1000eec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000ef3:	00 00 00 
+ 1000ef6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000efd:	00 00 00 
+ 1000f00:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000f07:	00 00 00 
+ 1000f0a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000f11:	00 00 00 
+ 1000f14:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000f1b:	00 00 00 
+ 1000f1e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000f25:	00 00 00 
+ 1000f28:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000f2f:	00 00 00 
+ 1000f32:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000f39:	00 00 00 
+ 1000f3c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000f43:	00 00 00 
+ 1000f46:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000f4d:	00 00 00 
+ 1000f50:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000f57:	00 00 00 
+ 1000f5a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000f61:	00 00 00 
+ 1000f64:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000f6b:	00 00 00 
+ 1000f6e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000f75:	00 00 00 
+ 1000f78:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000f7f:	00 00 00 
+ 1000f82:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000f89:	00 00 00 
+ 1000f8c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000f93:	00 00 00 
+ 1000f96:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000f9d:	00 00 00 
+ 1000fa0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000fa7:	00 00 00 
+ 1000faa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000fb1:	00 00 00 
+ 1000fb4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000fbb:	00 00 00 
+ 1000fbe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000fc5:	00 00 00 
+ 1000fc8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000fcf:	00 00 00 
+ 1000fd2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000fd9:	00 00 00 
+ 1000fdc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000fe3:	00 00 00 
+ 1000fe6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000fed:	00 00 00 
+ 1000ff0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1000ff7:	00 00 00 
+ 1000ffa:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
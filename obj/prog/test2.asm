@@ -0,0 +1,915 @@
+
+obj/prog/test2:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000001010000 <_start>:
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+ 1010000:	6a 00                	push   $0x0
+    pushq $0
+ 1010002:	6a 00                	push   $0x0
+
+0000000001010004 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+ 1010004:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+ 1010009:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+ 101000d:	31 ed                	xor    %ebp,%ebp
+    call libmain
+ 101000f:	e8 50 00 00 00       	call   1010064 <libmain>
+    jmp .
+ 1010014:	eb fe                	jmp    1010014 <args_exist+0x10>
+
+0000000001010016 <umain>:
+void (*volatile GRADE3_FUNC)(unsigned);
+void (*volatile xc(GRADE3_FAIL, GRADE3_PFX1))(void);
+#endif
+
+void
+umain(int argc, char **argv) {
+ 1010016:	55                   	push   %rbp
+ 1010017:	48 89 e5             	mov    %rsp,%rbp
+ 101001a:	41 54                	push   %r12
+ 101001c:	53                   	push   %rbx
+    int test2_i;
+    int test2_j;
+
+#if !defined(GRADE3_TEST)
+    cprintf("TEST2 LOADED.\n");
+ 101001d:	48 b8 10 10 01 01 00 	movabs $0x1011010,%rax
+ 1010024:	00 00 00 
+ 1010027:	48 8b 10             	mov    (%rax),%rdx
+ 101002a:	48 bf 98 00 01 01 00 	movabs $0x1010098,%rdi
+ 1010031:	00 00 00 
+ 1010034:	b8 00 00 00 00       	mov    $0x0,%eax
+ 1010039:	ff d2                	call   *%rdx
+ 101003b:	bb 05 00 00 00       	mov    $0x5,%ebx
+#endif
+
+    for (test2_j = 0; test2_j < 5; ++test2_j) {
+        for (test2_i = 0; test2_i < 10000; ++test2_i)
+            ;
+        sys_yield();
+ 1010040:	49 bc 08 10 01 01 00 	movabs $0x1011008,%r12
+ 1010047:	00 00 00 
+umain(int argc, char **argv) {
+ 101004a:	b8 10 27 00 00       	mov    $0x2710,%eax
+        for (test2_i = 0; test2_i < 10000; ++test2_i)
+ 101004f:	83 e8 01             	sub    $0x1,%eax
+ 1010052:	75 fb                	jne    101004f <umain+0x39>
+        sys_yield();
+ 1010054:	49 8b 04 24          	mov    (%r12),%rax
+ 1010058:	ff d0                	call   *%rax
+    for (test2_j = 0; test2_j < 5; ++test2_j) {
+ 101005a:	83 eb 01             	sub    $0x1,%ebx
+ 101005d:	75 eb                	jne    101004a <umain+0x34>
+    }
+}
+ 101005f:	5b                   	pop    %rbx
+ 1010060:	41 5c                	pop    %r12
+ 1010062:	5d                   	pop    %rbp
+ 1010063:	c3                   	ret
+
+0000000001010064 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+ 1010064:	55                   	push   %rbp
+ 1010065:	48 89 e5             	mov    %rsp,%rbp
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+ 1010068:	85 ff                	test   %edi,%edi
+ 101006a:	7e 0d                	jle    1010079 <libmain+0x15>
+ 101006c:	48 8b 06             	mov    (%rsi),%rax
+ 101006f:	48 a3 00 10 01 01 00 	movabs %rax,0x1011000
+ 1010076:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+ 1010079:	48 b8 16 00 01 01 00 	movabs $0x1010016,%rax
+ 1010080:	00 00 00 
+ 1010083:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+ 1010085:	48 a1 18 10 01 01 00 	movabs 0x1011018,%rax
+ 101008c:	00 00 00 
+ 101008f:	ff d0                	call   *%rax
+#endif
+}
+ 1010091:	5d                   	pop    %rbp
+ 1010092:	c3                   	ret
+ 1010093:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+ 1010098:	54                   	push   %rsp
+ 1010099:	45 53                	rex.RB push %r11
+ 101009b:	54                   	push   %rsp
+ 101009c:	32 20                	xor    (%rax),%ah
+ 101009e:	4c                   	rex.WR
+ 101009f:	4f                   	rex.WRXB
+ 10100a0:	41                   	rex.B
+ 10100a1:	44                   	rex.R
+ 10100a2:	45                   	rex.RB
+ 10100a3:	44                   	rex.R
+ 10100a4:	2e 0a 00             	cs or  (%rax),%al
+ 10100a7:	3c 75                	cmp    $0x75,%al
+ 10100a9:	6e                   	outsb  %ds:(%rsi),(%dx)
+ 10100aa:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+ 10100ae:	6e                   	outsb  %ds:(%rsi),(%dx)
+ 10100af:	3e 00 66 2e          	ds add %ah,0x2e(%rsi)
+ 10100b3:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+ 10100ba:	00 
+ 10100bb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10100c2:	00 00 00 
+ 10100c5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10100cc:	00 00 00 
+ 10100cf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10100d6:	00 00 00 
+ 10100d9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10100e0:	00 00 00 
+ 10100e3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10100ea:	00 00 00 
+ 10100ed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10100f4:	00 00 00 
+ 10100f7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10100fe:	00 00 00 
+ 1010101:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010108:	00 00 00 
+ 101010b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010112:	00 00 00 
+ 1010115:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 101011c:	00 00 00 
+ 101011f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010126:	00 00 00 
+ 1010129:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010130:	00 00 00 
+ 1010133:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 101013a:	00 00 00 
+ 101013d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010144:	00 00 00 
+ 1010147:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 101014e:	00 00 00 
+ 1010151:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010158:	00 00 00 
+ 101015b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010162:	00 00 00 
+ 1010165:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 101016c:	00 00 00 
+ 101016f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010176:	00 00 00 
+ 1010179:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010180:	00 00 00 
+ 1010183:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 101018a:	00 00 00 
+ 101018d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010194:	00 00 00 
+ 1010197:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 101019e:	00 00 00 
+ 10101a1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10101a8:	00 00 00 
+ 10101ab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10101b2:	00 00 00 
+ 10101b5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10101bc:	00 00 00 
+ 10101bf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10101c6:	00 00 00 
+ 10101c9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10101d0:	00 00 00 
+ 10101d3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10101da:	00 00 00 
+ 10101dd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10101e4:	00 00 00 
+ 10101e7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10101ee:	00 00 00 
+ 10101f1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10101f8:	00 00 00 
+ 10101fb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010202:	00 00 00 
+ 1010205:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 101020c:	00 00 00 
+ 101020f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010216:	00 00 00 
+ 1010219:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010220:	00 00 00 
+ 1010223:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 101022a:	00 00 00 
+ 101022d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010234:	00 00 00 
+ 1010237:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 101023e:	00 00 00 
+ 1010241:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010248:	00 00 00 
+ 101024b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010252:	00 00 00 
+ 1010255:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 101025c:	00 00 00 
+ 101025f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010266:	00 00 00 
+ 1010269:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010270:	00 00 00 
+ 1010273:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 101027a:	00 00 00 
+ 101027d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010284:	00 00 00 
+ 1010287:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 101028e:	00 00 00 
+ 1010291:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010298:	00 00 00 
+ 101029b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10102a2:	00 00 00 
+ 10102a5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10102ac:	00 00 00 
+ 10102af:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10102b6:	00 00 00 
+ 10102b9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10102c0:	00 00 00 
+ 10102c3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10102ca:	00 00 00 
+ 10102cd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10102d4:	00 00 00 
+ 10102d7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10102de:	00 00 00 
+ 10102e1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10102e8:	00 00 00 
+ 10102eb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10102f2:	00 00 00 
+ 10102f5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10102fc:	00 00 00 
+ 10102ff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010306:	00 00 00 
+ 1010309:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010310:	00 00 00 
+ 1010313:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 101031a:	00 00 00 
+ 101031d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010324:	00 00 00 
+ 1010327:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 101032e:	00 00 00 
+ 1010331:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010338:	00 00 00 
+ 101033b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010342:	00 00 00 
+ 1010345:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 101034c:	00 00 00 
+ 101034f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010356:	00 00 00 
+ 1010359:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010360:	00 00 00 
+ 1010363:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 101036a:	00 00 00 
+ 101036d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010374:	00 00 00 
+ 1010377:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 101037e:	00 00 00 
+ 1010381:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010388:	00 00 00 
+ 101038b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010392:	00 00 00 
+ 1010395:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 101039c:	00 00 00 
+ 101039f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10103a6:	00 00 00 
+ 10103a9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10103b0:	00 00 00 
+ 10103b3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10103ba:	00 00 00 
+ 10103bd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10103c4:	00 00 00 
+ 10103c7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10103ce:	00 00 00 
+ 10103d1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10103d8:	00 00 00 
+ 10103db:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10103e2:	00 00 00 
+ 10103e5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10103ec:	00 00 00 
+ 10103ef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10103f6:	00 00 00 
+ 10103f9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010400:	00 00 00 
+ 1010403:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 101040a:	00 00 00 
+ 101040d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010414:	00 00 00 
+ 1010417:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 101041e:	00 00 00 
+ 1010421:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010428:	00 00 00 
+ 101042b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010432:	00 00 00 
+ 1010435:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 101043c:	00 00 00 
+ 101043f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010446:	00 00 00 
+ 1010449:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010450:	00 00 00 
+ 1010453:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 101045a:	00 00 00 
+ 101045d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010464:	00 00 00 
+ 1010467:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 101046e:	00 00 00 
+ 1010471:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010478:	00 00 00 
+ 101047b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010482:	00 00 00 
+ 1010485:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 101048c:	00 00 00 
+ 101048f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010496:	00 00 00 
+ 1010499:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10104a0:	00 00 00 
+ 10104a3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10104aa:	00 00 00 
+ 10104ad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10104b4:	00 00 00 
+ 10104b7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10104be:	00 00 00 
+ 10104c1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10104c8:	00 00 00 
+ 10104cb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10104d2:	00 00 00 
+ 10104d5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10104dc:	00 00 00 
+ 10104df:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10104e6:	00 00 00 
+ 10104e9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10104f0:	00 00 00 
+ 10104f3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10104fa:	00 00 00 
+ 10104fd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010504:	00 00 00 
+ 1010507:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 101050e:	00 00 00 
+ 1010511:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010518:	00 00 00 
+ 101051b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010522:	00 00 00 
+ 1010525:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 101052c:	00 00 00 
+ 101052f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010536:	00 00 00 
+ 1010539:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010540:	00 00 00 
+ 1010543:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 101054a:	00 00 00 
+ 101054d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010554:	00 00 00 
+ 1010557:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 101055e:	00 00 00 
+ 1010561:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010568:	00 00 00 
+ 101056b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010572:	00 00 00 
+ 1010575:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 101057c:	00 00 00 
+ 101057f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010586:	00 00 00 
+ 1010589:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010590:	00 00 00 
+ 1010593:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 101059a:	00 00 00 
+ 101059d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10105a4:	00 00 00 
+ 10105a7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10105ae:	00 00 00 
+ 10105b1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10105b8:	00 00 00 
+ 10105bb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10105c2:	00 00 00 
+ 10105c5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10105cc:	00 00 00 
+ 10105cf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10105d6:	00 00 00 
+ 10105d9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10105e0:	00 00 00 
+ 10105e3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10105ea:	00 00 00 
+ 10105ed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10105f4:	00 00 00 
+ 10105f7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10105fe:	00 00 00 
+ 1010601:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010608:	00 00 00 
+ 101060b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010612:	00 00 00 
+ 1010615:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 101061c:	00 00 00 
+ 101061f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010626:	00 00 00 
+ 1010629:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010630:	00 00 00 
+ 1010633:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 101063a:	00 00 00 
+ 101063d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010644:	00 00 00 
+ 1010647:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 101064e:	00 00 00 
+ 1010651:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010658:	00 00 00 
+ 101065b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010662:	00 00 00 
+ 1010665:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 101066c:	00 00 00 
+ 101066f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010676:	00 00 00 
+ 1010679:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010680:	00 00 00 
+ 1010683:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 101068a:	00 00 00 
+ 101068d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010694:	00 00 00 
+ 1010697:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 101069e:	00 00 00 
+ 10106a1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10106a8:	00 00 00 
+ 10106ab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10106b2:	00 00 00 
+ 10106b5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10106bc:	00 00 00 
+ 10106bf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10106c6:	00 00 00 
+ 10106c9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10106d0:	00 00 00 
+ 10106d3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10106da:	00 00 00 
+ 10106dd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10106e4:	00 00 00 
+ 10106e7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10106ee:	00 00 00 
+ 10106f1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10106f8:	00 00 00 
+ 10106fb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010702:	00 00 00 
+ 1010705:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 101070c:	00 00 00 
+ 101070f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010716:	00 00 00 
+ 1010719:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010720:	00 00 00 
+ 1010723:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 101072a:	00 00 00 
+ 101072d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010734:	00 00 00 
+ 1010737:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 101073e:	00 00 00 
+ 1010741:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010748:	00 00 00 
+ 101074b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010752:	00 00 00 
+ 1010755:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 101075c:	00 00 00 
+ 101075f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010766:	00 00 00 
+ 1010769:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010770:	00 00 00 
+ 1010773:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 101077a:	00 00 00 
+ 101077d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010784:	00 00 00 
+ 1010787:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 101078e:	00 00 00 
+ 1010791:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010798:	00 00 00 
+ 101079b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10107a2:	00 00 00 
+ 10107a5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10107ac:	00 00 00 
+ 10107af:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10107b6:	00 00 00 
+ 10107b9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10107c0:	00 00 00 
+ 10107c3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10107ca:	00 00 00 
+ 10107cd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10107d4:	00 00 00 
+ 10107d7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10107de:	00 00 00 
+ 10107e1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10107e8:	00 00 00 
+ 10107eb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10107f2:	00 00 00 
+ 10107f5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10107fc:	00 00 00 
+ 10107ff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010806:	00 00 00 
+ 1010809:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010810:	00 00 00 
+ 1010813:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 101081a:	00 00 00 
+ 101081d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010824:	00 00 00 
+ 1010827:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 101082e:	00 00 00 
+ 1010831:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010838:	00 00 00 
+ 101083b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010842:	00 00 00 
+ 1010845:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 101084c:	00 00 00 
+ 101084f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010856:	00 00 00 
+ 1010859:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010860:	00 00 00 
+ 1010863:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 101086a:	00 00 00 
+ 101086d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010874:	00 00 00 
+ 1010877:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 101087e:	00 00 00 
+ 1010881:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010888:	00 00 00 
+ 101088b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010892:	00 00 00 
+ 1010895:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 101089c:	00 00 00 
+ 101089f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10108a6:	00 00 00 
+ 10108a9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10108b0:	00 00 00 
+ 10108b3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10108ba:	00 00 00 
+ 10108bd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10108c4:	00 00 00 
+ 10108c7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10108ce:	00 00 00 
+ 10108d1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10108d8:	00 00 00 
+ 10108db:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10108e2:	00 00 00 
+ 10108e5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10108ec:	00 00 00 
+ 10108ef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10108f6:	00 00 00 
+ 10108f9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010900:	00 00 00 
+ 1010903:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 101090a:	00 00 00 
+ 101090d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010914:	00 00 00 
+ 1010917:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 101091e:	00 00 00 
+ 1010921:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010928:	00 00 00 
+ 101092b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010932:	00 00 00 
+ 1010935:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 101093c:	00 00 00 
+ 101093f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010946:	00 00 00 
+ 1010949:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010950:	00 00 00 
+ 1010953:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 101095a:	00 00 00 
+ 101095d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010964:	00 00 00 
+ 1010967:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 101096e:	00 00 00 
+ 1010971:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010978:	00 00 00 
+ 101097b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010982:	00 00 00 
+ 1010985:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 101098c:	00 00 00 
+ 101098f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010996:	00 00 00 
+ 1010999:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10109a0:	00 00 00 
+ 10109a3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10109aa:	00 00 00 
+ 10109ad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10109b4:	00 00 00 
+ 10109b7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10109be:	00 00 00 
+ 10109c1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10109c8:	00 00 00 
+ 10109cb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10109d2:	00 00 00 
+ 10109d5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10109dc:	00 00 00 
+ 10109df:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10109e6:	00 00 00 
+ 10109e9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10109f0:	00 00 00 
+ 10109f3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10109fa:	00 00 00 
+ 10109fd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010a04:	00 00 00 
+ 1010a07:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010a0e:	00 00 00 
+ 1010a11:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010a18:	00 00 00 
+ 1010a1b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010a22:	00 00 00 
+ 1010a25:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010a2c:	00 00 00 
+ 1010a2f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010a36:	00 00 00 
+ 1010a39:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010a40:	00 00 00 
+ 1010a43:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010a4a:	00 00 00 
+ 1010a4d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010a54:	00 00 00 
+ 1010a57:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010a5e:	00 00 00 
+ 1010a61:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010a68:	00 00 00 
+ 1010a6b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010a72:	00 00 00 
+ 1010a75:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010a7c:	00 00 00 
+ 1010a7f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010a86:	00 00 00 
+ 1010a89:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010a90:	00 00 00 
+ 1010a93:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010a9a:	00 00 00 
+ 1010a9d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010aa4:	00 00 00 
+ 1010aa7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010aae:	00 00 00 
+ 1010ab1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010ab8:	00 00 00 
+ 1010abb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010ac2:	00 00 00 
+ 1010ac5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010acc:	00 00 00 
+ 1010acf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010ad6:	00 00 00 
+ 1010ad9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010ae0:	00 00 00 
+ 1010ae3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010aea:	00 00 00 
+ 1010aed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010af4:	00 00 00 
+ 1010af7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010afe:	00 00 00 
+ 1010b01:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010b08:	00 00 00 
+ 1010b0b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010b12:	00 00 00 
+ 1010b15:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010b1c:	00 00 00 
+ 1010b1f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010b26:	00 00 00 
+ 1010b29:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010b30:	00 00 00 
+ 1010b33:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010b3a:	00 00 00 
+ 1010b3d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010b44:	00 00 00 
+ 1010b47:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010b4e:	00 00 00 
+ 1010b51:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010b58:	00 00 00 
+ 1010b5b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010b62:	00 00 00 
+ 1010b65:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010b6c:	00 00 00 
+ 1010b6f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010b76:	00 00 00 
+ 1010b79:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010b80:	00 00 00 
+ 1010b83:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010b8a:	00 00 00 
+ 1010b8d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010b94:	00 00 00 
+ 1010b97:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010b9e:	00 00 00 
+ 1010ba1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010ba8:	00 00 00 
+ 1010bab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010bb2:	00 00 00 
+ 1010bb5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010bbc:	00 00 00 
+ 1010bbf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010bc6:	00 00 00 
+ 1010bc9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010bd0:	00 00 00 
+ 1010bd3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010bda:	00 00 00 
+ 1010bdd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010be4:	00 00 00 
+ 1010be7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010bee:	00 00 00 
+ 1010bf1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010bf8:	00 00 00 
+ 1010bfb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010c02:	00 00 00 
+ 1010c05:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010c0c:	00 00 00 
+ 1010c0f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010c16:	00 00 00 
+ 1010c19:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010c20:	00 00 00 
+ 1010c23:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010c2a:	00 00 00 
+ 1010c2d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010c34:	00 00 00 
+ 1010c37:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010c3e:	00 00 00 
+ 1010c41:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010c48:	00 00 00 
+ 1010c4b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010c52:	00 00 00 
+ 1010c55:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010c5c:	00 00 00 
+ 1010c5f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010c66:	00 00 00 
+ 1010c69:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010c70:	00 00 00 
+ 1010c73:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010c7a:	00 00 00 
+ 1010c7d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010c84:	00 00 00 
+ 1010c87:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010c8e:	00 00 00 
+ 1010c91:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010c98:	00 00 00 
+ 1010c9b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010ca2:	00 00 00 
+ 1010ca5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010cac:	00 00 00 
+ 1010caf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010cb6:	00 00 00 
+ 1010cb9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010cc0:	00 00 00 
+ 1010cc3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010cca:	00 00 00 
+ 1010ccd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010cd4:	00 00 00 
+ 1010cd7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010cde:	00 00 00 
+ 1010ce1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010ce8:	00 00 00 
+ 1010ceb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010cf2:	00 00 00 
+ 1010cf5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010cfc:	00 00 00 
+ 1010cff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010d06:	00 00 00 
+ 1010d09:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010d10:	00 00 00 
+ 1010d13:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010d1a:	00 00 00 
+ 1010d1d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010d24:	00 00 00 
+ 1010d27:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010d2e:	00 00 00 
+ 1010d31:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010d38:	00 00 00 
+ 1010d3b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010d42:	00 00 00 
+ 1010d45:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010d4c:	00 00 00 
+ 1010d4f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010d56:	00 00 00 
+ 1010d59:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010d60:	00 00 00 
+ 1010d63:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010d6a:	00 00 00 
+ 1010d6d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010d74:	00 00 00 
+ 1010d77:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010d7e:	00 00 00 
+ 1010d81:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010d88:	00 00 00 
+ 1010d8b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010d92:	00 00 00 
+ 1010d95:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010d9c:	00 00 00 
+ 1010d9f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010da6:	00 00 00 
+ 1010da9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010db0:	00 00 00 
+ 1010db3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010dba:	00 00 00 
+ 1010dbd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010dc4:	00 00 00 
+ 1010dc7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010dce:	00 00 00 
+ 1010dd1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010dd8:	00 00 00 
+ 1010ddb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010de2:	00 00 00 
+ 1010de5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010dec:	00 00 00 
+ 1010def:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010df6:	00 00 00 
+ 1010df9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010e00:	00 00 00 
+ 1010e03:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010e0a:	00 00 00 
+ 1010e0d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010e14:	00 00 00 
+ 1010e17:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010e1e:	00 00 00 
+ 1010e21:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010e28:	00 00 00 
+ 1010e2b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010e32:	00 00 00 
+ 1010e35:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010e3c:	00 00 00 
+ 1010e3f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010e46:	00 00 00 
+ 1010e49:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010e50:	00 00 00 
+ 1010e53:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010e5a:	00 00 00 
+ 1010e5d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010e64:	00 00 00 
+ 1010e67:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010e6e:	00 00 00 
+ 1010e71:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010e78:	00 00 00 
+ 1010e7b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010e82:	00 00 00 
+ 1010e85:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010e8c:	00 00 00 
+ 1010e8f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010e96:	00 00 00 
+ 1010e99:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010ea0:	00 00 00 
+ 1010ea3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010eaa:	00 00 00 
+ 1010ead:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010eb4:	00 00 00 
+ 1010eb7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010ebe:	00 00 00 
+ 1010ec1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010ec8:	00 00 00 
+ 1010ecb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010ed2:	00 00 00 
+ 1010ed5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010edc:	00 00 00 
+ 1010edf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010ee6:	00 00 00 
+ 1010ee9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010ef0:	00 00 00 
+ 1010ef3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010efa:	00 00 00 
+ 1010efd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010f04:	00 00 00 
+ 1010f07:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010f0e:	00 00 00 
+ 1010f11:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010f18:	00 00 00 
+ 1010f1b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010f22:	00 00 00 
+ 1010f25:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010f2c:	00 00 00 
+ 1010f2f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010f36:	00 00 00 
+ 1010f39:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010f40:	00 00 00 
+ 1010f43:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010f4a:	00 00 00 
+ 1010f4d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010f54:	00 00 00 
+ 1010f57:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010f5e:	00 00 00 
+ 1010f61:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010f68:	00 00 00 
+ 1010f6b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010f72:	00 00 00 
+ 1010f75:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010f7c:	00 00 00 
+ 1010f7f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010f86:	00 00 00 
+ 1010f89:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010f90:	00 00 00 
+ 1010f93:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010f9a:	00 00 00 
+ 1010f9d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010fa4:	00 00 00 
+ 1010fa7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010fae:	00 00 00 
+ 1010fb1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010fb8:	00 00 00 
+ 1010fbb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010fc2:	00 00 00 
+ 1010fc5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010fcc:	00 00 00 
+ 1010fcf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010fd6:	00 00 00 
+ 1010fd9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010fe0:	00 00 00 
+ 1010fe3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010fea:	00 00 00 
+ 1010fed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1010ff4:	00 00 00 
+ 1010ff7:	66 0f 1f 84 00 00 00 	nopw   0x0(%rax,%rax,1)
+ 1010ffe:	00 00 
@@ -0,0 +1,899 @@
+
+obj/prog/test3:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000001020000 <_start>:
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+ 1020000:	6a 00                	push   $0x0
+    pushq $0
+ 1020002:	6a 00                	push   $0x0
+
+0000000001020004 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+ 1020004:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+ 1020009:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+ 102000d:	31 ed                	xor    %ebp,%ebp
+    call libmain
+ 102000f:	e8 32 00 00 00       	call   1020046 <libmain>
+    jmp .
+ 1020014:	eb fe                	jmp    1020014 <args_exist+0x10>
+
+0000000001020016 <umain>:
+void (*volatile sys_yield)(void);
+
+void
+umain(int argc, char **argv) {
+ 1020016:	55                   	push   %rbp
+ 1020017:	48 89 e5             	mov    %rsp,%rbp
+ 102001a:	41 54                	push   %r12
+ 102001c:	53                   	push   %rbx
+ 102001d:	bb 03 00 00 00       	mov    $0x3,%ebx
+    int i, j;
+
+    for (j = 0; j < 3; ++j) {
+        for (i = 0; i < 10000; ++i)
+            ;
+        sys_yield();
+ 1020022:	49 bc 08 10 02 01 00 	movabs $0x1021008,%r12
+ 1020029:	00 00 00 
+umain(int argc, char **argv) {
+ 102002c:	b8 10 27 00 00       	mov    $0x2710,%eax
+        for (i = 0; i < 10000; ++i)
+ 1020031:	83 e8 01             	sub    $0x1,%eax
+ 1020034:	75 fb                	jne    1020031 <umain+0x1b>
+        sys_yield();
+ 1020036:	49 8b 04 24          	mov    (%r12),%rax
+ 102003a:	ff d0                	call   *%rax
+    for (j = 0; j < 3; ++j) {
+ 102003c:	83 eb 01             	sub    $0x1,%ebx
+ 102003f:	75 eb                	jne    102002c <umain+0x16>
+    }
+}
+ 1020041:	5b                   	pop    %rbx
+ 1020042:	41 5c                	pop    %r12
+ 1020044:	5d                   	pop    %rbp
+ 1020045:	c3                   	ret
+
+0000000001020046 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+ 1020046:	55                   	push   %rbp
+ 1020047:	48 89 e5             	mov    %rsp,%rbp
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+ 102004a:	85 ff                	test   %edi,%edi
+ 102004c:	7e 0d                	jle    102005b <libmain+0x15>
+ 102004e:	48 8b 06             	mov    (%rsi),%rax
+ 1020051:	48 a3 00 10 02 01 00 	movabs %rax,0x1021000
+ 1020058:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+ 102005b:	48 b8 16 00 02 01 00 	movabs $0x1020016,%rax
+ 1020062:	00 00 00 
+ 1020065:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+ 1020067:	48 a1 10 10 02 01 00 	movabs 0x1021010,%rax
+ 102006e:	00 00 00 
+ 1020071:	ff d0                	call   *%rax
+#endif
+}
+ 1020073:	5d                   	pop    %rbp
+ 1020074:	c3                   	ret
+ 1020075:	0f 1f 00             	nopl   (%rax)
+ 1020078:	3c 75                	cmp    $0x75,%al
+ 102007a:	6e                   	outsb  %ds:(%rsi),(%dx)
+ 102007b:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+ 102007f:	6e                   	outsb  %ds:(%rsi),(%dx)
+ 1020080:	3e 00 66 2e          	ds add %ah,0x2e(%rsi)
+ 1020084:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+ 102008b:	00 
+ 102008c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020093:	00 00 00 
+ 1020096:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 102009d:	00 00 00 
+ 10200a0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10200a7:	00 00 00 
+ 10200aa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10200b1:	00 00 00 
+ 10200b4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10200bb:	00 00 00 
+ 10200be:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10200c5:	00 00 00 
+ 10200c8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10200cf:	00 00 00 
+ 10200d2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10200d9:	00 00 00 
+ 10200dc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10200e3:	00 00 00 
+ 10200e6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10200ed:	00 00 00 
+ 10200f0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10200f7:	00 00 00 
+ 10200fa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020101:	00 00 00 
+ 1020104:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 102010b:	00 00 00 
+ 102010e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020115:	00 00 00 
+ 1020118:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 102011f:	00 00 00 
+ 1020122:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020129:	00 00 00 
+ 102012c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020133:	00 00 00 
+ 1020136:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 102013d:	00 00 00 
+ 1020140:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020147:	00 00 00 
+ 102014a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020151:	00 00 00 
+ 1020154:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 102015b:	00 00 00 
+ 102015e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020165:	00 00 00 
+ 1020168:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 102016f:	00 00 00 
+ 1020172:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020179:	00 00 00 
+ 102017c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020183:	00 00 00 
+ 1020186:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 102018d:	00 00 00 
+ 1020190:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020197:	00 00 00 
+ 102019a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10201a1:	00 00 00 
+ 10201a4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10201ab:	00 00 00 
+ 10201ae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10201b5:	00 00 00 
+ 10201b8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10201bf:	00 00 00 
+ 10201c2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10201c9:	00 00 00 
+ 10201cc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10201d3:	00 00 00 
+ 10201d6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10201dd:	00 00 00 
+ 10201e0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10201e7:	00 00 00 
+ 10201ea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10201f1:	00 00 00 
+ 10201f4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10201fb:	00 00 00 
+ 10201fe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020205:	00 00 00 
+ 1020208:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 102020f:	00 00 00 
+ 1020212:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020219:	00 00 00 
+ 102021c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020223:	00 00 00 
+ 1020226:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 102022d:	00 00 00 
+ 1020230:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020237:	00 00 00 
+ 102023a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020241:	00 00 00 
+ 1020244:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 102024b:	00 00 00 
+ 102024e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020255:	00 00 00 
+ 1020258:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 102025f:	00 00 00 
+ 1020262:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020269:	00 00 00 
+ 102026c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020273:	00 00 00 
+ 1020276:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 102027d:	00 00 00 
+ 1020280:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020287:	00 00 00 
+ 102028a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020291:	00 00 00 
+ 1020294:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 102029b:	00 00 00 
+ 102029e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10202a5:	00 00 00 
+ 10202a8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10202af:	00 00 00 
+ 10202b2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10202b9:	00 00 00 
+ 10202bc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10202c3:	00 00 00 
+ 10202c6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10202cd:	00 00 00 
+ 10202d0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10202d7:	00 00 00 
+ 10202da:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10202e1:	00 00 00 
+ 10202e4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10202eb:	00 00 00 
+ 10202ee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10202f5:	00 00 00 
+ 10202f8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10202ff:	00 00 00 
+ 1020302:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020309:	00 00 00 
+ 102030c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020313:	00 00 00 
+ 1020316:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 102031d:	00 00 00 
+ 1020320:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020327:	00 00 00 
+ 102032a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020331:	00 00 00 
+ 1020334:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 102033b:	00 00 00 
+ 102033e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020345:	00 00 00 
+ 1020348:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 102034f:	00 00 00 
+ 1020352:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020359:	00 00 00 
+ 102035c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020363:	00 00 00 
+ 1020366:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 102036d:	00 00 00 
+ 1020370:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020377:	00 00 00 
+ 102037a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020381:	00 00 00 
+ 1020384:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 102038b:	00 00 00 
+ 102038e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020395:	00 00 00 
+ 1020398:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 102039f:	00 00 00 
+ 10203a2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10203a9:	00 00 00 
+ 10203ac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10203b3:	00 00 00 
+ 10203b6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10203bd:	00 00 00 
+ 10203c0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10203c7:	00 00 00 
+ 10203ca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10203d1:	00 00 00 
+ 10203d4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10203db:	00 00 00 
+ 10203de:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10203e5:	00 00 00 
+ 10203e8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10203ef:	00 00 00 
+ 10203f2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10203f9:	00 00 00 
+ 10203fc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020403:	00 00 00 
+ 1020406:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 102040d:	00 00 00 
+ 1020410:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020417:	00 00 00 
+ 102041a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020421:	00 00 00 
+ 1020424:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 102042b:	00 00 00 
+ 102042e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020435:	00 00 00 
+ 1020438:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 102043f:	00 00 00 
+ 1020442:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020449:	00 00 00 
+ 102044c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020453:	00 00 00 
+ 1020456:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 102045d:	00 00 00 
+ 1020460:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020467:	00 00 00 
+ 102046a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020471:	00 00 00 
+ 1020474:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 102047b:	00 00 00 
+ 102047e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020485:	00 00 00 
+ 1020488:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 102048f:	00 00 00 
+ 1020492:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020499:	00 00 00 
+ 102049c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10204a3:	00 00 00 
+ 10204a6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10204ad:	00 00 00 
+ 10204b0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10204b7:	00 00 00 
+ 10204ba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10204c1:	00 00 00 
+ 10204c4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10204cb:	00 00 00 
+ 10204ce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10204d5:	00 00 00 
+ 10204d8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10204df:	00 00 00 
+ 10204e2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10204e9:	00 00 00 
+ 10204ec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10204f3:	00 00 00 
+ 10204f6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10204fd:	00 00 00 
+ 1020500:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020507:	00 00 00 
+ 102050a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020511:	00 00 00 
+ 1020514:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 102051b:	00 00 00 
+ 102051e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020525:	00 00 00 
+ 1020528:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 102052f:	00 00 00 
+ 1020532:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020539:	00 00 00 
+ 102053c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020543:	00 00 00 
+ 1020546:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 102054d:	00 00 00 
+ 1020550:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020557:	00 00 00 
+ 102055a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020561:	00 00 00 
+ 1020564:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 102056b:	00 00 00 
+ 102056e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020575:	00 00 00 
+ 1020578:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 102057f:	00 00 00 
+ 1020582:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020589:	00 00 00 
+ 102058c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020593:	00 00 00 
+ 1020596:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 102059d:	00 00 00 
+ 10205a0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10205a7:	00 00 00 
+ 10205aa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10205b1:	00 00 00 
+ 10205b4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10205bb:	00 00 00 
+ 10205be:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10205c5:	00 00 00 
+ 10205c8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10205cf:	00 00 00 
+ 10205d2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10205d9:	00 00 00 
+ 10205dc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10205e3:	00 00 00 
+ 10205e6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10205ed:	00 00 00 
+ 10205f0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10205f7:	00 00 00 
+ 10205fa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020601:	00 00 00 
+ 1020604:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 102060b:	00 00 00 
+ 102060e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020615:	00 00 00 
+ 1020618:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 102061f:	00 00 00 
+ 1020622:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020629:	00 00 00 
+ 102062c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020633:	00 00 00 
+ 1020636:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 102063d:	00 00 00 
+ 1020640:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020647:	00 00 00 
+ 102064a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020651:	00 00 00 
+ 1020654:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 102065b:	00 00 00 
+ 102065e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020665:	00 00 00 
+ 1020668:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 102066f:	00 00 00 
+ 1020672:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020679:	00 00 00 
+ 102067c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020683:	00 00 00 
+ 1020686:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 102068d:	00 00 00 
+ 1020690:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020697:	00 00 00 
+ 102069a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10206a1:	00 00 00 
+ 10206a4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10206ab:	00 00 00 
+ 10206ae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10206b5:	00 00 00 
+ 10206b8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10206bf:	00 00 00 
+ 10206c2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10206c9:	00 00 00 
+ 10206cc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10206d3:	00 00 00 
+ 10206d6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10206dd:	00 00 00 
+ 10206e0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10206e7:	00 00 00 
+ 10206ea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10206f1:	00 00 00 
+ 10206f4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10206fb:	00 00 00 
+ 10206fe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020705:	00 00 00 
+ 1020708:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 102070f:	00 00 00 
+ 1020712:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020719:	00 00 00 
+ 102071c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020723:	00 00 00 
+ 1020726:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 102072d:	00 00 00 
+ 1020730:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020737:	00 00 00 
+ 102073a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020741:	00 00 00 
+ 1020744:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 102074b:	00 00 00 
+ 102074e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020755:	00 00 00 
+ 1020758:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 102075f:	00 00 00 
+ 1020762:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020769:	00 00 00 
+ 102076c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020773:	00 00 00 
+ 1020776:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 102077d:	00 00 00 
+ 1020780:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020787:	00 00 00 
+ 102078a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020791:	00 00 00 
+ 1020794:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 102079b:	00 00 00 
+ 102079e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10207a5:	00 00 00 
+ 10207a8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10207af:	00 00 00 
+ 10207b2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10207b9:	00 00 00 
+ 10207bc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10207c3:	00 00 00 
+ 10207c6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10207cd:	00 00 00 
+ 10207d0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10207d7:	00 00 00 
+ 10207da:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10207e1:	00 00 00 
+ 10207e4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10207eb:	00 00 00 
+ 10207ee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10207f5:	00 00 00 
+ 10207f8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10207ff:	00 00 00 
+ 1020802:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020809:	00 00 00 
+ 102080c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020813:	00 00 00 
+ 1020816:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 102081d:	00 00 00 
+ 1020820:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020827:	00 00 00 
+ 102082a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020831:	00 00 00 
+ 1020834:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 102083b:	00 00 00 
+ 102083e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020845:	00 00 00 
+ 1020848:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 102084f:	00 00 00 
+ 1020852:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020859:	00 00 00 
+ 102085c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020863:	00 00 00 
+ 1020866:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 102086d:	00 00 00 
+ 1020870:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020877:	00 00 00 
+ 102087a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020881:	00 00 00 
+ 1020884:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 102088b:	00 00 00 
+ 102088e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020895:	00 00 00 
+ 1020898:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 102089f:	00 00 00 
+ 10208a2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10208a9:	00 00 00 
+ 10208ac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10208b3:	00 00 00 
+ 10208b6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10208bd:	00 00 00 
+ 10208c0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10208c7:	00 00 00 
+ 10208ca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10208d1:	00 00 00 
+ 10208d4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10208db:	00 00 00 
+ 10208de:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10208e5:	00 00 00 
+ 10208e8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10208ef:	00 00 00 
+ 10208f2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10208f9:	00 00 00 
+ 10208fc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020903:	00 00 00 
+ 1020906:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 102090d:	00 00 00 
+ 1020910:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020917:	00 00 00 
+ 102091a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020921:	00 00 00 
+ 1020924:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 102092b:	00 00 00 
+ 102092e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020935:	00 00 00 
+ 1020938:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 102093f:	00 00 00 
+ 1020942:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020949:	00 00 00 
+ 102094c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020953:	00 00 00 
+ 1020956:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 102095d:	00 00 00 
+ 1020960:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020967:	00 00 00 
+ 102096a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020971:	00 00 00 
+ 1020974:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 102097b:	00 00 00 
+ 102097e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020985:	00 00 00 
+ 1020988:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 102098f:	00 00 00 
+ 1020992:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020999:	00 00 00 
+ 102099c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10209a3:	00 00 00 
+ 10209a6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10209ad:	00 00 00 
+ 10209b0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10209b7:	00 00 00 
+ 10209ba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10209c1:	00 00 00 
+ 10209c4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10209cb:	00 00 00 
+ 10209ce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10209d5:	00 00 00 
+ 10209d8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10209df:	00 00 00 
+ 10209e2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10209e9:	00 00 00 
+ 10209ec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10209f3:	00 00 00 
+ 10209f6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10209fd:	00 00 00 
+ 1020a00:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020a07:	00 00 00 
+ 1020a0a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020a11:	00 00 00 
+ 1020a14:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020a1b:	00 00 00 
+ 1020a1e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020a25:	00 00 00 
+ 1020a28:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020a2f:	00 00 00 
+ 1020a32:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020a39:	00 00 00 
+ 1020a3c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020a43:	00 00 00 
+ 1020a46:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020a4d:	00 00 00 
+ 1020a50:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020a57:	00 00 00 
+ 1020a5a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020a61:	00 00 00 
+ 1020a64:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020a6b:	00 00 00 
+ 1020a6e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020a75:	00 00 00 
+ 1020a78:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020a7f:	00 00 00 
+ 1020a82:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020a89:	00 00 00 
+ 1020a8c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020a93:	00 00 00 
+ 1020a96:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020a9d:	00 00 00 
+ 1020aa0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020aa7:	00 00 00 
+ 1020aaa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020ab1:	00 00 00 
+ 1020ab4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020abb:	00 00 00 
+ 1020abe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020ac5:	00 00 00 
+ 1020ac8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020acf:	00 00 00 
+ 1020ad2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020ad9:	00 00 00 
+ 1020adc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020ae3:	00 00 00 
+ 1020ae6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020aed:	00 00 00 
+ 1020af0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020af7:	00 00 00 
+ 1020afa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020b01:	00 00 00 
+ 1020b04:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020b0b:	00 00 00 
+ 1020b0e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020b15:	00 00 00 
+ 1020b18:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020b1f:	00 00 00 
+ 1020b22:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020b29:	00 00 00 
+ 1020b2c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020b33:	00 00 00 
+ 1020b36:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020b3d:	00 00 00 
+ 1020b40:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020b47:	00 00 00 
+ 1020b4a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020b51:	00 00 00 
+ 1020b54:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020b5b:	00 00 00 
+ 1020b5e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020b65:	00 00 00 
+ 1020b68:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020b6f:	00 00 00 
+ 1020b72:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020b79:	00 00 00 
+ 1020b7c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020b83:	00 00 00 
+ 1020b86:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020b8d:	00 00 00 
+ 1020b90:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020b97:	00 00 00 
+ 1020b9a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020ba1:	00 00 00 
+ 1020ba4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020bab:	00 00 00 
+ 1020bae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020bb5:	00 00 00 
+ 1020bb8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020bbf:	00 00 00 
+ 1020bc2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020bc9:	00 00 00 
+ 1020bcc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020bd3:	00 00 00 
+ 1020bd6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020bdd:	00 00 00 
+ 1020be0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020be7:	00 00 00 
+ 1020bea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020bf1:	00 00 00 
+ 1020bf4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020bfb:	00 00 00 
+ 1020bfe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020c05:	00 00 00 
+ 1020c08:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020c0f:	00 00 00 
+ 1020c12:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020c19:	00 00 00 
+ 1020c1c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020c23:	00 00 00 
+ 1020c26:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020c2d:	00 00 00 
+ 1020c30:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020c37:	00 00 00 
+ 1020c3a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020c41:	00 00 00 
+ 1020c44:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020c4b:	00 00 00 
+ 1020c4e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020c55:	00 00 00 
+ 1020c58:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020c5f:	00 00 00 
+ 1020c62:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020c69:	00 00 00 
+ 1020c6c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020c73:	00 00 00 
+ 1020c76:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020c7d:	00 00 00 
+ 1020c80:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020c87:	00 00 00 
+ 1020c8a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020c91:	00 00 00 
+ 1020c94:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020c9b:	00 00 00 
+ 1020c9e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020ca5:	00 00 00 
+ 1020ca8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020caf:	00 00 00 
+ 1020cb2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020cb9:	00 00 00 
+ 1020cbc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020cc3:	00 00 00 
+ 1020cc6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020ccd:	00 00 00 
+ 1020cd0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020cd7:	00 00 00 
+ 1020cda:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020ce1:	00 00 00 
+ 1020ce4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020ceb:	00 00 00 
+ 1020cee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020cf5:	00 00 00 
+ 1020cf8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020cff:	00 00 00 
+ 1020d02:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020d09:	00 00 00 
+ 1020d0c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020d13:	00 00 00 
+ 1020d16:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020d1d:	00 00 00 
+ 1020d20:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020d27:	00 00 00 
+ 1020d2a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020d31:	00 00 00 
+ 1020d34:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020d3b:	00 00 00 
+ 1020d3e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020d45:	00 00 00 
+ 1020d48:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020d4f:	00 00 00 
+ 1020d52:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020d59:	00 00 00 
+ 1020d5c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020d63:	00 00 00 
+ 1020d66:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020d6d:	00 00 00 
+ 1020d70:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020d77:	00 00 00 
+ 1020d7a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020d81:	00 00 00 
+ 1020d84:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020d8b:	00 00 00 
+ 1020d8e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020d95:	00 00 00 
+ 1020d98:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020d9f:	00 00 00 
+ 1020da2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020da9:	00 00 00 
+ 1020dac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020db3:	00 00 00 
+ 1020db6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020dbd:	00 00 00 
+ 1020dc0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020dc7:	00 00 00 
+ 1020dca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020dd1:	00 00 00 
+ 1020dd4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020ddb:	00 00 00 
+ 1020dde:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020de5:	00 00 00 
+ 1020de8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020def:	00 00 00 
+ 1020df2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020df9:	00 00 00 
+ 1020dfc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020e03:	00 00 00 
+ 1020e06:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020e0d:	00 00 00 
+ 1020e10:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020e17:	00 00 00 
+ 1020e1a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020e21:	00 00 00 
+ 1020e24:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020e2b:	00 00 00 
+ 1020e2e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020e35:	00 00 00 
+ 1020e38:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020e3f:	00 00 00 
+ 1020e42:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020e49:	00 00 00 
+ 1020e4c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020e53:	00 00 00 
+ 1020e56:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020e5d:	00 00 00 
+ 1020e60:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020e67:	00 00 00 
+ 1020e6a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020e71:	00 00 00 
+ 1020e74:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020e7b:	00 00 00 
+ 1020e7e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020e85:	00 00 00 
+ 1020e88:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020e8f:	00 00 00 
+ 1020e92:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020e99:	00 00 00 
+ 1020e9c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020ea3:	00 00 00 
+ 1020ea6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020ead:	00 00 00 
+ 1020eb0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020eb7:	00 00 00 
+ 1020eba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020ec1:	00 00 00 
+ 1020ec4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020ecb:	00 00 00 
+ 1020ece:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020ed5:	00 00 00 
+ 1020ed8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020edf:	00 00 00 
+ 1020ee2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020ee9:	00 00 00 
+ 1020eec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020ef3:	00 00 00 
+ 1020ef6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020efd:	00 00 00 
+ 1020f00:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020f07:	00 00 00 
+ 1020f0a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020f11:	00 00 00 
+ 1020f14:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020f1b:	00 00 00 
+ 1020f1e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020f25:	00 00 00 
+ 1020f28:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020f2f:	00 00 00 
+ 1020f32:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020f39:	00 00 00 
+ 1020f3c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020f43:	00 00 00 
+ 1020f46:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020f4d:	00 00 00 
+ 1020f50:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020f57:	00 00 00 
+ 1020f5a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020f61:	00 00 00 
+ 1020f64:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020f6b:	00 00 00 
+ 1020f6e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020f75:	00 00 00 
+ 1020f78:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020f7f:	00 00 00 
+ 1020f82:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020f89:	00 00 00 
+ 1020f8c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020f93:	00 00 00 
+ 1020f96:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020f9d:	00 00 00 
+ 1020fa0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020fa7:	00 00 00 
+ 1020faa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020fb1:	00 00 00 
+ 1020fb4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020fbb:	00 00 00 
+ 1020fbe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020fc5:	00 00 00 
+ 1020fc8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020fcf:	00 00 00 
+ 1020fd2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020fd9:	00 00 00 
+ 1020fdc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020fe3:	00 00 00 
+ 1020fe6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020fed:	00 00 00 
+ 1020ff0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1020ff7:	00 00 00 
+ 1020ffa:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
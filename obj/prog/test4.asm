@@ -0,0 +1,893 @@
+
+obj/prog/test4:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000001030000 <_start>:
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+ 1030000:	6a 00                	push   $0x0
+    pushq $0
+ 1030002:	6a 00                	push   $0x0
+
+0000000001030004 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+ 1030004:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+ 1030009:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+ 103000d:	31 ed                	xor    %ebp,%ebp
+    call libmain
+ 103000f:	e8 26 00 00 00       	call   103003a <libmain>
+    jmp .
+ 1030014:	eb fe                	jmp    1030014 <args_exist+0x10>
+
+0000000001030016 <umain>:
+
+int (*volatile cprintf)(const char *fmt, ...);
+
+void
+umain(int argc, char **argv) {
+ 1030016:	55                   	push   %rbp
+ 1030017:	48 89 e5             	mov    %rsp,%rbp
+    cprintf("TEST4 LOADED.\n");
+ 103001a:	48 b8 08 10 03 01 00 	movabs $0x1031008,%rax
+ 1030021:	00 00 00 
+ 1030024:	48 8b 10             	mov    (%rax),%rdx
+ 1030027:	48 bf 70 00 03 01 00 	movabs $0x1030070,%rdi
+ 103002e:	00 00 00 
+ 1030031:	b8 00 00 00 00       	mov    $0x0,%eax
+ 1030036:	ff d2                	call   *%rdx
+
+    for (;;)
+ 1030038:	eb fe                	jmp    1030038 <umain+0x22>
+
+000000000103003a <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+ 103003a:	55                   	push   %rbp
+ 103003b:	48 89 e5             	mov    %rsp,%rbp
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+ 103003e:	85 ff                	test   %edi,%edi
+ 1030040:	7e 0d                	jle    103004f <libmain+0x15>
+ 1030042:	48 8b 06             	mov    (%rsi),%rax
+ 1030045:	48 a3 00 10 03 01 00 	movabs %rax,0x1031000
+ 103004c:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+ 103004f:	48 b8 16 00 03 01 00 	movabs $0x1030016,%rax
+ 1030056:	00 00 00 
+ 1030059:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+ 103005b:	48 a1 10 10 03 01 00 	movabs 0x1031010,%rax
+ 1030062:	00 00 00 
+ 1030065:	ff d0                	call   *%rax
+#endif
+}
+ 1030067:	5d                   	pop    %rbp
+ 1030068:	c3                   	ret
+ 1030069:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+ 1030070:	54                   	push   %rsp
+ 1030071:	45 53                	rex.RB push %r11
+ 1030073:	54                   	push   %rsp
+ 1030074:	34 20                	xor    $0x20,%al
+ 1030076:	4c                   	rex.WR
+ 1030077:	4f                   	rex.WRXB
+ 1030078:	41                   	rex.B
+ 1030079:	44                   	rex.R
+ 103007a:	45                   	rex.RB
+ 103007b:	44                   	rex.R
+ 103007c:	2e 0a 00             	cs or  (%rax),%al
+ 103007f:	3c 75                	cmp    $0x75,%al
+ 1030081:	6e                   	outsb  %ds:(%rsi),(%dx)
+ 1030082:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+ 1030086:	6e                   	outsb  %ds:(%rsi),(%dx)
+ 1030087:	3e 00 66 2e          	ds add %ah,0x2e(%rsi)
+ 103008b:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+ 1030092:	00 
+ 1030093:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 103009a:	00 00 00 
+ 103009d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10300a4:	00 00 00 
+ 10300a7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10300ae:	00 00 00 
+ 10300b1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10300b8:	00 00 00 
+ 10300bb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10300c2:	00 00 00 
+ 10300c5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10300cc:	00 00 00 
+ 10300cf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10300d6:	00 00 00 
+ 10300d9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10300e0:	00 00 00 
+ 10300e3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10300ea:	00 00 00 
+ 10300ed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10300f4:	00 00 00 
+ 10300f7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10300fe:	00 00 00 
+ 1030101:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030108:	00 00 00 
+ 103010b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030112:	00 00 00 
+ 1030115:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 103011c:	00 00 00 
+ 103011f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030126:	00 00 00 
+ 1030129:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030130:	00 00 00 
+ 1030133:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 103013a:	00 00 00 
+ 103013d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030144:	00 00 00 
+ 1030147:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 103014e:	00 00 00 
+ 1030151:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030158:	00 00 00 
+ 103015b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030162:	00 00 00 
+ 1030165:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 103016c:	00 00 00 
+ 103016f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030176:	00 00 00 
+ 1030179:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030180:	00 00 00 
+ 1030183:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 103018a:	00 00 00 
+ 103018d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030194:	00 00 00 
+ 1030197:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 103019e:	00 00 00 
+ 10301a1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10301a8:	00 00 00 
+ 10301ab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10301b2:	00 00 00 
+ 10301b5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10301bc:	00 00 00 
+ 10301bf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10301c6:	00 00 00 
+ 10301c9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10301d0:	00 00 00 
+ 10301d3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10301da:	00 00 00 
+ 10301dd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10301e4:	00 00 00 
+ 10301e7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10301ee:	00 00 00 
+ 10301f1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10301f8:	00 00 00 
+ 10301fb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030202:	00 00 00 
+ 1030205:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 103020c:	00 00 00 
+ 103020f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030216:	00 00 00 
+ 1030219:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030220:	00 00 00 
+ 1030223:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 103022a:	00 00 00 
+ 103022d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030234:	00 00 00 
+ 1030237:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 103023e:	00 00 00 
+ 1030241:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030248:	00 00 00 
+ 103024b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030252:	00 00 00 
+ 1030255:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 103025c:	00 00 00 
+ 103025f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030266:	00 00 00 
+ 1030269:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030270:	00 00 00 
+ 1030273:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 103027a:	00 00 00 
+ 103027d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030284:	00 00 00 
+ 1030287:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 103028e:	00 00 00 
+ 1030291:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030298:	00 00 00 
+ 103029b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10302a2:	00 00 00 
+ 10302a5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10302ac:	00 00 00 
+ 10302af:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10302b6:	00 00 00 
+ 10302b9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10302c0:	00 00 00 
+ 10302c3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10302ca:	00 00 00 
+ 10302cd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10302d4:	00 00 00 
+ 10302d7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10302de:	00 00 00 
+ 10302e1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10302e8:	00 00 00 
+ 10302eb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10302f2:	00 00 00 
+ 10302f5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10302fc:	00 00 00 
+ 10302ff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030306:	00 00 00 
+ 1030309:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030310:	00 00 00 
+ 1030313:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 103031a:	00 00 00 
+ 103031d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030324:	00 00 00 
+ 1030327:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 103032e:	00 00 00 
+ 1030331:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030338:	00 00 00 
+ 103033b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030342:	00 00 00 
+ 1030345:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 103034c:	00 00 00 
+ 103034f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030356:	00 00 00 
+ 1030359:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030360:	00 00 00 
+ 1030363:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 103036a:	00 00 00 
+ 103036d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030374:	00 00 00 
+ 1030377:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 103037e:	00 00 00 
+ 1030381:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030388:	00 00 00 
+ 103038b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030392:	00 00 00 
+ 1030395:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 103039c:	00 00 00 
+ 103039f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10303a6:	00 00 00 
+ 10303a9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10303b0:	00 00 00 
+ 10303b3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10303ba:	00 00 00 
+ 10303bd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10303c4:	00 00 00 
+ 10303c7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10303ce:	00 00 00 
+ 10303d1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10303d8:	00 00 00 
+ 10303db:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10303e2:	00 00 00 
+ 10303e5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10303ec:	00 00 00 
+ 10303ef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10303f6:	00 00 00 
+ 10303f9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030400:	00 00 00 
+ 1030403:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 103040a:	00 00 00 
+ 103040d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030414:	00 00 00 
+ 1030417:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 103041e:	00 00 00 
+ 1030421:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030428:	00 00 00 
+ 103042b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030432:	00 00 00 
+ 1030435:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 103043c:	00 00 00 
+ 103043f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030446:	00 00 00 
+ 1030449:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030450:	00 00 00 
+ 1030453:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 103045a:	00 00 00 
+ 103045d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030464:	00 00 00 
+ 1030467:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 103046e:	00 00 00 
+ 1030471:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030478:	00 00 00 
+ 103047b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030482:	00 00 00 
+ 1030485:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 103048c:	00 00 00 
+ 103048f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030496:	00 00 00 
+ 1030499:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10304a0:	00 00 00 
+ 10304a3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10304aa:	00 00 00 
+ 10304ad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10304b4:	00 00 00 
+ 10304b7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10304be:	00 00 00 
+ 10304c1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10304c8:	00 00 00 
+ 10304cb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10304d2:	00 00 00 
+ 10304d5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10304dc:	00 00 00 
+ 10304df:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10304e6:	00 00 00 
+ 10304e9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10304f0:	00 00 00 
+ 10304f3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10304fa:	00 00 00 
+ 10304fd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030504:	00 00 00 
+ 1030507:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 103050e:	00 00 00 
+ 1030511:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030518:	00 00 00 
+ 103051b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030522:	00 00 00 
+ 1030525:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 103052c:	00 00 00 
+ 103052f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030536:	00 00 00 
+ 1030539:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030540:	00 00 00 
+ 1030543:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 103054a:	00 00 00 
+ 103054d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030554:	00 00 00 
+ 1030557:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 103055e:	00 00 00 
+ 1030561:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030568:	00 00 00 
+ 103056b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030572:	00 00 00 
+ 1030575:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 103057c:	00 00 00 
+ 103057f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030586:	00 00 00 
+ 1030589:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030590:	00 00 00 
+ 1030593:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 103059a:	00 00 00 
+ 103059d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10305a4:	00 00 00 
+ 10305a7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10305ae:	00 00 00 
+ 10305b1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10305b8:	00 00 00 
+ 10305bb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10305c2:	00 00 00 
+ 10305c5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10305cc:	00 00 00 
+ 10305cf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10305d6:	00 00 00 
+ 10305d9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10305e0:	00 00 00 
+ 10305e3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10305ea:	00 00 00 
+ 10305ed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10305f4:	00 00 00 
+ 10305f7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10305fe:	00 00 00 
+ 1030601:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030608:	00 00 00 
+ 103060b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030612:	00 00 00 
+ 1030615:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 103061c:	00 00 00 
+ 103061f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030626:	00 00 00 
+ 1030629:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030630:	00 00 00 
+ 1030633:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 103063a:	00 00 00 
+ 103063d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030644:	00 00 00 
+ 1030647:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 103064e:	00 00 00 
+ 1030651:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030658:	00 00 00 
+ 103065b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030662:	00 00 00 
+ 1030665:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 103066c:	00 00 00 
+ 103066f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030676:	00 00 00 
+ 1030679:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030680:	00 00 00 
+ 1030683:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 103068a:	00 00 00 
+ 103068d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030694:	00 00 00 
+ 1030697:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 103069e:	00 00 00 
+ 10306a1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10306a8:	00 00 00 
+ 10306ab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10306b2:	00 00 00 
+ 10306b5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10306bc:	00 00 00 
+ 10306bf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10306c6:	00 00 00 
+ 10306c9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10306d0:	00 00 00 
+ 10306d3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10306da:	00 00 00 
+ 10306dd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10306e4:	00 00 00 
+ 10306e7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10306ee:	00 00 00 
+ 10306f1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10306f8:	00 00 00 
+ 10306fb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030702:	00 00 00 
+ 1030705:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 103070c:	00 00 00 
+ 103070f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030716:	00 00 00 
+ 1030719:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030720:	00 00 00 
+ 1030723:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 103072a:	00 00 00 
+ 103072d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030734:	00 00 00 
+ 1030737:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 103073e:	00 00 00 
+ 1030741:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030748:	00 00 00 
+ 103074b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030752:	00 00 00 
+ 1030755:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 103075c:	00 00 00 
+ 103075f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030766:	00 00 00 
+ 1030769:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030770:	00 00 00 
+ 1030773:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 103077a:	00 00 00 
+ 103077d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030784:	00 00 00 
+ 1030787:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 103078e:	00 00 00 
+ 1030791:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030798:	00 00 00 
+ 103079b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10307a2:	00 00 00 
+ 10307a5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10307ac:	00 00 00 
+ 10307af:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10307b6:	00 00 00 
+ 10307b9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10307c0:	00 00 00 
+ 10307c3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10307ca:	00 00 00 
+ 10307cd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10307d4:	00 00 00 
+ 10307d7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10307de:	00 00 00 
+ 10307e1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10307e8:	00 00 00 
+ 10307eb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10307f2:	00 00 00 
+ 10307f5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10307fc:	00 00 00 
+ 10307ff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030806:	00 00 00 
+ 1030809:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030810:	00 00 00 
+ 1030813:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 103081a:	00 00 00 
+ 103081d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030824:	00 00 00 
+ 1030827:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 103082e:	00 00 00 
+ 1030831:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030838:	00 00 00 
+ 103083b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030842:	00 00 00 
+ 1030845:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 103084c:	00 00 00 
+ 103084f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030856:	00 00 00 
+ 1030859:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030860:	00 00 00 
+ 1030863:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 103086a:	00 00 00 
+ 103086d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030874:	00 00 00 
+ 1030877:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 103087e:	00 00 00 
+ 1030881:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030888:	00 00 00 
+ 103088b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030892:	00 00 00 
+ 1030895:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 103089c:	00 00 00 
+ 103089f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10308a6:	00 00 00 
+ 10308a9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10308b0:	00 00 00 
+ 10308b3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10308ba:	00 00 00 
+ 10308bd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10308c4:	00 00 00 
+ 10308c7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10308ce:	00 00 00 
+ 10308d1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10308d8:	00 00 00 
+ 10308db:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10308e2:	00 00 00 
+ 10308e5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10308ec:	00 00 00 
+ 10308ef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10308f6:	00 00 00 
+ 10308f9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030900:	00 00 00 
+ 1030903:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 103090a:	00 00 00 
+ 103090d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030914:	00 00 00 
+ 1030917:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 103091e:	00 00 00 
+ 1030921:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030928:	00 00 00 
+ 103092b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030932:	00 00 00 
+ 1030935:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 103093c:	00 00 00 
+ 103093f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030946:	00 00 00 
+ 1030949:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030950:	00 00 00 
+ 1030953:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 103095a:	00 00 00 
+ 103095d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030964:	00 00 00 
+ 1030967:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 103096e:	00 00 00 
+ 1030971:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030978:	00 00 00 
+ 103097b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030982:	00 00 00 
+ 1030985:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 103098c:	00 00 00 
+ 103098f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030996:	00 00 00 
+ 1030999:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10309a0:	00 00 00 
+ 10309a3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10309aa:	00 00 00 
+ 10309ad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10309b4:	00 00 00 
+ 10309b7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10309be:	00 00 00 
+ 10309c1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10309c8:	00 00 00 
+ 10309cb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10309d2:	00 00 00 
+ 10309d5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10309dc:	00 00 00 
+ 10309df:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10309e6:	00 00 00 
+ 10309e9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10309f0:	00 00 00 
+ 10309f3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10309fa:	00 00 00 
+ 10309fd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030a04:	00 00 00 
+ 1030a07:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030a0e:	00 00 00 
+ 1030a11:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030a18:	00 00 00 
+ 1030a1b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030a22:	00 00 00 
+ 1030a25:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030a2c:	00 00 00 
+ 1030a2f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030a36:	00 00 00 
+ 1030a39:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030a40:	00 00 00 
+ 1030a43:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030a4a:	00 00 00 
+ 1030a4d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030a54:	00 00 00 
+ 1030a57:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030a5e:	00 00 00 
+ 1030a61:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030a68:	00 00 00 
+ 1030a6b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030a72:	00 00 00 
+ 1030a75:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030a7c:	00 00 00 
+ 1030a7f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030a86:	00 00 00 
+ 1030a89:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030a90:	00 00 00 
+ 1030a93:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030a9a:	00 00 00 
+ 1030a9d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030aa4:	00 00 00 
+ 1030aa7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030aae:	00 00 00 
+ 1030ab1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030ab8:	00 00 00 
+ 1030abb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030ac2:	00 00 00 
+ 1030ac5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030acc:	00 00 00 
+ 1030acf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030ad6:	00 00 00 
+ 1030ad9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030ae0:	00 00 00 
+ 1030ae3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030aea:	00 00 00 
+ 1030aed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030af4:	00 00 00 
+ 1030af7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030afe:	00 00 00 
+ 1030b01:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030b08:	00 00 00 
+ 1030b0b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030b12:	00 00 00 
+ 1030b15:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030b1c:	00 00 00 
+ 1030b1f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030b26:	00 00 00 
+ 1030b29:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030b30:	00 00 00 
+ 1030b33:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030b3a:	00 00 00 
+ 1030b3d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030b44:	00 00 00 
+ 1030b47:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030b4e:	00 00 00 
+ 1030b51:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030b58:	00 00 00 
+ 1030b5b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030b62:	00 00 00 
+ 1030b65:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030b6c:	00 00 00 
+ 1030b6f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030b76:	00 00 00 
+ 1030b79:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030b80:	00 00 00 
+ 1030b83:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030b8a:	00 00 00 
+ 1030b8d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030b94:	00 00 00 
+ 1030b97:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030b9e:	00 00 00 
+ 1030ba1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030ba8:	00 00 00 
+ 1030bab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030bb2:	00 00 00 
+ 1030bb5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030bbc:	00 00 00 
+ 1030bbf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030bc6:	00 00 00 
+ 1030bc9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030bd0:	00 00 00 
+ 1030bd3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030bda:	00 00 00 
+ 1030bdd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030be4:	00 00 00 
+ 1030be7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030bee:	00 00 00 
+ 1030bf1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030bf8:	00 00 00 
+ 1030bfb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030c02:	00 00 00 
+ 1030c05:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030c0c:	00 00 00 
+ 1030c0f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030c16:	00 00 00 
+ 1030c19:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030c20:	00 00 00 
+ 1030c23:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030c2a:	00 00 00 
+ 1030c2d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030c34:	00 00 00 
+ 1030c37:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030c3e:	00 00 00 
+ 1030c41:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030c48:	00 00 00 
+ 1030c4b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030c52:	00 00 00 
+ 1030c55:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030c5c:	00 00 00 
+ 1030c5f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030c66:	00 00 00 
+ 1030c69:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030c70:	00 00 00 
+ 1030c73:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030c7a:	00 00 00 
+ 1030c7d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030c84:	00 00 00 
+ 1030c87:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030c8e:	00 00 00 
+ 1030c91:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030c98:	00 00 00 
+ 1030c9b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030ca2:	00 00 00 
+ 1030ca5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030cac:	00 00 00 
+ 1030caf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030cb6:	00 00 00 
+ 1030cb9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030cc0:	00 00 00 
+ 1030cc3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030cca:	00 00 00 
+ 1030ccd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030cd4:	00 00 00 
+ 1030cd7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030cde:	00 00 00 
+ 1030ce1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030ce8:	00 00 00 
+ 1030ceb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030cf2:	00 00 00 
+ 1030cf5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030cfc:	00 00 00 
+ 1030cff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030d06:	00 00 00 
+ 1030d09:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030d10:	00 00 00 
+ 1030d13:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030d1a:	00 00 00 
+ 1030d1d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030d24:	00 00 00 
+ 1030d27:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030d2e:	00 00 00 
+ 1030d31:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030d38:	00 00 00 
+ 1030d3b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030d42:	00 00 00 
+ 1030d45:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030d4c:	00 00 00 
+ 1030d4f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030d56:	00 00 00 
+ 1030d59:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030d60:	00 00 00 
+ 1030d63:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030d6a:	00 00 00 
+ 1030d6d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030d74:	00 00 00 
+ 1030d77:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030d7e:	00 00 00 
+ 1030d81:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030d88:	00 00 00 
+ 1030d8b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030d92:	00 00 00 
+ 1030d95:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030d9c:	00 00 00 
+ 1030d9f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030da6:	00 00 00 
+ 1030da9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030db0:	00 00 00 
+ 1030db3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030dba:	00 00 00 
+ 1030dbd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030dc4:	00 00 00 
+ 1030dc7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030dce:	00 00 00 
+ 1030dd1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030dd8:	00 00 00 
+ 1030ddb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030de2:	00 00 00 
+ 1030de5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030dec:	00 00 00 
+ 1030def:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030df6:	00 00 00 
+ 1030df9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030e00:	00 00 00 
+ 1030e03:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030e0a:	00 00 00 
+ 1030e0d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030e14:	00 00 00 
+ 1030e17:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030e1e:	00 00 00 
+ 1030e21:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030e28:	00 00 00 
+ 1030e2b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030e32:	00 00 00 
+ 1030e35:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030e3c:	00 00 00 
+ 1030e3f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030e46:	00 00 00 
+ 1030e49:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030e50:	00 00 00 
+ 1030e53:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030e5a:	00 00 00 
+ 1030e5d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030e64:	00 00 00 
+ 1030e67:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030e6e:	00 00 00 
+ 1030e71:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030e78:	00 00 00 
+ 1030e7b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030e82:	00 00 00 
+ 1030e85:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030e8c:	00 00 00 
+ 1030e8f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030e96:	00 00 00 
+ 1030e99:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030ea0:	00 00 00 
+ 1030ea3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030eaa:	00 00 00 
+ 1030ead:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030eb4:	00 00 00 
+ 1030eb7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030ebe:	00 00 00 
+ 1030ec1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030ec8:	00 00 00 
+ 1030ecb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030ed2:	00 00 00 
+ 1030ed5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030edc:	00 00 00 
+ 1030edf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030ee6:	00 00 00 
+ 1030ee9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030ef0:	00 00 00 
+ 1030ef3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030efa:	00 00 00 
+ 1030efd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030f04:	00 00 00 
+ 1030f07:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030f0e:	00 00 00 
+ 1030f11:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030f18:	00 00 00 
+ 1030f1b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030f22:	00 00 00 
+ 1030f25:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030f2c:	00 00 00 
+ 1030f2f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030f36:	00 00 00 
+ 1030f39:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030f40:	00 00 00 
+ 1030f43:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030f4a:	00 00 00 
+ 1030f4d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030f54:	00 00 00 
+ 1030f57:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030f5e:	00 00 00 
+ 1030f61:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030f68:	00 00 00 
+ 1030f6b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030f72:	00 00 00 
+ 1030f75:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030f7c:	00 00 00 
+ 1030f7f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030f86:	00 00 00 
+ 1030f89:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030f90:	00 00 00 
+ 1030f93:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030f9a:	00 00 00 
+ 1030f9d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030fa4:	00 00 00 
+ 1030fa7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030fae:	00 00 00 
+ 1030fb1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030fb8:	00 00 00 
+ 1030fbb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030fc2:	00 00 00 
+ 1030fc5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030fcc:	00 00 00 
+ 1030fcf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030fd6:	00 00 00 
+ 1030fd9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030fe0:	00 00 00 
+ 1030fe3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030fea:	00 00 00 
+ 1030fed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1030ff4:	00 00 00 
+ 1030ff7:	66 0f 1f 84 00 00 00 	nopw   0x0(%rax,%rax,1)
+ 1030ffe:	00 00 
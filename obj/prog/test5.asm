@@ -0,0 +1,992 @@
+
+obj/prog/test5:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000001040000 <_start>:
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+ 1040000:	6a 00                	push   $0x0
+    pushq $0
+ 1040002:	6a 00                	push   $0x0
+
+0000000001040004 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+ 1040004:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+ 1040009:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+ 104000d:	31 ed                	xor    %ebp,%ebp
+    call libmain
+ 104000f:	e8 92 01 00 00       	call   10401a6 <libmain>
+    jmp .
+ 1040014:	eb fe                	jmp    1040014 <args_exist+0x10>
+
+0000000001040016 <test_rec>:
+void (*volatile sys_yield)(void);
+
+unsigned int deep = 0;
+
+void
+test_rec(void) {
+ 1040016:	55                   	push   %rbp
+ 1040017:	48 89 e5             	mov    %rsp,%rbp
+ 104001a:	53                   	push   %rbx
+ 104001b:	48 83 ec 08          	sub    $0x8,%rsp
+    void *buf;
+    ++deep;
+ 104001f:	48 b8 a8 10 04 01 00 	movabs $0x10410a8,%rax
+ 1040026:	00 00 00 
+ 1040029:	83 00 01             	addl   $0x1,(%rax)
+
+    if (!(rand() % 79)) {
+ 104002c:	48 b8 d5 01 04 01 00 	movabs $0x10401d5,%rax
+ 1040033:	00 00 00 
+ 1040036:	ff d0                	call   *%rax
+ 1040038:	48 63 d0             	movslq %eax,%rdx
+ 104003b:	48 69 d2 55 3a b2 67 	imul   $0x67b23a55,%rdx,%rdx
+ 1040042:	48 c1 fa 25          	sar    $0x25,%rdx
+ 1040046:	89 c1                	mov    %eax,%ecx
+ 1040048:	c1 f9 1f             	sar    $0x1f,%ecx
+ 104004b:	29 ca                	sub    %ecx,%edx
+ 104004d:	6b d2 4f             	imul   $0x4f,%edx,%edx
+ 1040050:	39 d0                	cmp    %edx,%eax
+ 1040052:	75 0c                	jne    1040060 <test_rec+0x4a>
+        sys_yield();
+ 1040054:	48 a1 b0 10 04 01 00 	movabs 0x10410b0,%rax
+ 104005b:	00 00 00 
+ 104005e:	ff d0                	call   *%rax
+    }
+
+    buf = test_alloc(rand() % 300);
+ 1040060:	48 b8 c0 10 04 01 00 	movabs $0x10410c0,%rax
+ 1040067:	00 00 00 
+ 104006a:	48 8b 18             	mov    (%rax),%rbx
+ 104006d:	48 b8 d5 01 04 01 00 	movabs $0x10401d5,%rax
+ 1040074:	00 00 00 
+ 1040077:	ff d0                	call   *%rax
+ 1040079:	48 63 d0             	movslq %eax,%rdx
+ 104007c:	48 69 d2 b5 81 4e 1b 	imul   $0x1b4e81b5,%rdx,%rdx
+ 1040083:	48 c1 fa 25          	sar    $0x25,%rdx
+ 1040087:	89 c1                	mov    %eax,%ecx
+ 1040089:	c1 f9 1f             	sar    $0x1f,%ecx
+ 104008c:	29 ca                	sub    %ecx,%edx
+ 104008e:	69 d2 2c 01 00 00    	imul   $0x12c,%edx,%edx
+ 1040094:	29 d0                	sub    %edx,%eax
+ 1040096:	0f b6 f8             	movzbl %al,%edi
+ 1040099:	ff d3                	call   *%rbx
+ 104009b:	48 89 c3             	mov    %rax,%rbx
+    if (buf) {
+ 104009e:	48 85 c0             	test   %rax,%rax
+ 10400a1:	74 6a                	je     104010d <test_rec+0xf7>
+        if (deep < 200 && (rand() % 53)) {
+ 10400a3:	48 b8 a8 10 04 01 00 	movabs $0x10410a8,%rax
+ 10400aa:	00 00 00 
+ 10400ad:	81 38 c7 00 00 00    	cmpl   $0xc7,(%rax)
+ 10400b3:	76 22                	jbe    10400d7 <test_rec+0xc1>
+            test_rec();
+        }
+        test_free(buf);
+ 10400b5:	48 a1 b8 10 04 01 00 	movabs 0x10410b8,%rax
+ 10400bc:	00 00 00 
+ 10400bf:	48 89 df             	mov    %rbx,%rdi
+ 10400c2:	ff d0                	call   *%rax
+        if (deep < 200 && (rand() % 17)) {
+            test_rec();
+        }
+    }
+
+    --deep;
+ 10400c4:	48 b8 a8 10 04 01 00 	movabs $0x10410a8,%rax
+ 10400cb:	00 00 00 
+ 10400ce:	83 28 01             	subl   $0x1,(%rax)
+    return;
+}
+ 10400d1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+ 10400d5:	c9                   	leave
+ 10400d6:	c3                   	ret
+        if (deep < 200 && (rand() % 53)) {
+ 10400d7:	48 b8 d5 01 04 01 00 	movabs $0x10401d5,%rax
+ 10400de:	00 00 00 
+ 10400e1:	ff d0                	call   *%rax
+ 10400e3:	48 63 d0             	movslq %eax,%rdx
+ 10400e6:	48 69 d2 ed 73 48 4d 	imul   $0x4d4873ed,%rdx,%rdx
+ 10400ed:	48 c1 fa 24          	sar    $0x24,%rdx
+ 10400f1:	89 c1                	mov    %eax,%ecx
+ 10400f3:	c1 f9 1f             	sar    $0x1f,%ecx
+ 10400f6:	29 ca                	sub    %ecx,%edx
+ 10400f8:	6b d2 35             	imul   $0x35,%edx,%edx
+ 10400fb:	39 d0                	cmp    %edx,%eax
+ 10400fd:	74 b6                	je     10400b5 <test_rec+0x9f>
+            test_rec();
+ 10400ff:	48 b8 16 00 04 01 00 	movabs $0x1040016,%rax
+ 1040106:	00 00 00 
+ 1040109:	ff d0                	call   *%rax
+ 104010b:	eb a8                	jmp    10400b5 <test_rec+0x9f>
+        if (deep < 200 && (rand() % 17)) {
+ 104010d:	48 b8 a8 10 04 01 00 	movabs $0x10410a8,%rax
+ 1040114:	00 00 00 
+ 1040117:	81 38 c7 00 00 00    	cmpl   $0xc7,(%rax)
+ 104011d:	77 a5                	ja     10400c4 <test_rec+0xae>
+ 104011f:	48 b8 d5 01 04 01 00 	movabs $0x10401d5,%rax
+ 1040126:	00 00 00 
+ 1040129:	ff d0                	call   *%rax
+ 104012b:	48 63 d0             	movslq %eax,%rdx
+ 104012e:	48 69 d2 79 78 78 78 	imul   $0x78787879,%rdx,%rdx
+ 1040135:	48 c1 fa 23          	sar    $0x23,%rdx
+ 1040139:	89 c1                	mov    %eax,%ecx
+ 104013b:	c1 f9 1f             	sar    $0x1f,%ecx
+ 104013e:	29 ca                	sub    %ecx,%edx
+ 1040140:	89 d1                	mov    %edx,%ecx
+ 1040142:	c1 e1 04             	shl    $0x4,%ecx
+ 1040145:	01 ca                	add    %ecx,%edx
+ 1040147:	39 d0                	cmp    %edx,%eax
+ 1040149:	0f 84 75 ff ff ff    	je     10400c4 <test_rec+0xae>
+            test_rec();
+ 104014f:	48 b8 16 00 04 01 00 	movabs $0x1040016,%rax
+ 1040156:	00 00 00 
+ 1040159:	ff d0                	call   *%rax
+ 104015b:	e9 64 ff ff ff       	jmp    10400c4 <test_rec+0xae>
+
+0000000001040160 <umain>:
+
+void
+umain(int argc, char **argv) {
+ 1040160:	55                   	push   %rbp
+ 1040161:	48 89 e5             	mov    %rsp,%rbp
+ 1040164:	53                   	push   %rbx
+ 1040165:	48 83 ec 08          	sub    $0x8,%rsp
+
+    #if !defined(GRADE3_TEST)
+    cprintf("TEST5 LOADED.\n");
+ 1040169:	48 b8 c8 10 04 01 00 	movabs $0x10410c8,%rax
+ 1040170:	00 00 00 
+ 1040173:	48 8b 10             	mov    (%rax),%rdx
+ 1040176:	48 bf 28 02 04 01 00 	movabs $0x1040228,%rdi
+ 104017d:	00 00 00 
+ 1040180:	b8 00 00 00 00       	mov    $0x0,%eax
+ 1040185:	ff d2                	call   *%rdx
+    #endif
+
+    rand_init(4);
+ 1040187:	bf 04 00 00 00       	mov    $0x4,%edi
+ 104018c:	48 b8 fe 01 04 01 00 	movabs $0x10401fe,%rax
+ 1040193:	00 00 00 
+ 1040196:	ff d0                	call   *%rax
+    for (;;) {
+        test_rec();
+ 1040198:	48 bb 16 00 04 01 00 	movabs $0x1040016,%rbx
+ 104019f:	00 00 00 
+ 10401a2:	ff d3                	call   *%rbx
+    for (;;) {
+ 10401a4:	eb fc                	jmp    10401a2 <umain+0x42>
+
+00000000010401a6 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+ 10401a6:	55                   	push   %rbp
+ 10401a7:	48 89 e5             	mov    %rsp,%rbp
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+ 10401aa:	85 ff                	test   %edi,%edi
+ 10401ac:	7e 0d                	jle    10401bb <libmain+0x15>
+ 10401ae:	48 8b 06             	mov    (%rsi),%rax
+ 10401b1:	48 a3 00 10 04 01 00 	movabs %rax,0x1041000
+ 10401b8:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+ 10401bb:	48 b8 60 01 04 01 00 	movabs $0x1040160,%rax
+ 10401c2:	00 00 00 
+ 10401c5:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+ 10401c7:	48 a1 d0 10 04 01 00 	movabs 0x10410d0,%rax
+ 10401ce:	00 00 00 
+ 10401d1:	ff d0                	call   *%rax
+#endif
+}
+ 10401d3:	5d                   	pop    %rbp
+ 10401d4:	c3                   	ret
+
+00000000010401d5 <rand>:
+
+static unsigned int next = 1;
+
+static int
+rand_r(unsigned int *seed) {
+    *seed = *seed * 1103515245 + 12345;
+ 10401d5:	48 ba 08 10 04 01 00 	movabs $0x1041008,%rdx
+ 10401dc:	00 00 00 
+ 10401df:	69 02 6d 4e c6 41    	imul   $0x41c64e6d,(%rdx),%eax
+ 10401e5:	05 39 30 00 00       	add    $0x3039,%eax
+ 10401ea:	89 02                	mov    %eax,(%rdx)
+    return (*seed % ((unsigned int)RAND_MAX + 1));
+ 10401ec:	25 ff ff ff 7f       	and    $0x7fffffff,%eax
+}
+
+int
+rand(void) {
+    return (rand_r(&next));
+}
+ 10401f1:	c3                   	ret
+
+00000000010401f2 <srand>:
+
+void
+srand(unsigned int seed) {
+    next = seed;
+ 10401f2:	89 f8                	mov    %edi,%eax
+ 10401f4:	a3 08 10 04 01 00 00 	movabs %eax,0x1041008
+ 10401fb:	00 00 
+}
+ 10401fd:	c3                   	ret
+
+00000000010401fe <rand_init>:
+
+void
+rand_init(unsigned int num) {
+ 10401fe:	89 f8                	mov    %edi,%eax
+    srand(((unsigned int *)_dev_urandom)[num % _dev_urandom_len]);
+ 1040200:	48 b9 20 10 04 01 00 	movabs $0x1041020,%rcx
+ 1040207:	00 00 00 
+ 104020a:	ba 00 00 00 00       	mov    $0x0,%edx
+ 104020f:	f7 31                	divl   (%rcx)
+    next = seed;
+ 1040211:	48 b8 40 10 04 01 00 	movabs $0x1041040,%rax
+ 1040218:	00 00 00 
+ 104021b:	8b 04 90             	mov    (%rax,%rdx,4),%eax
+ 104021e:	a3 08 10 04 01 00 00 	movabs %eax,0x1041008
+ 1040225:	00 00 
+}
+ 1040227:	c3                   	ret
+ 1040228:	54                   	push   %rsp
+ 1040229:	45 53                	rex.RB push %r11
+ 104022b:	54                   	push   %rsp
+ 104022c:	35 20 4c 4f 41       	xor    $0x414f4c20,%eax
+ 1040231:	44                   	rex.R
+ 1040232:	45                   	rex.RB
+ 1040233:	44                   	rex.R
+ 1040234:	2e 0a 00             	cs or  (%rax),%al
+ 1040237:	3c 75                	cmp    $0x75,%al
+ 1040239:	6e                   	outsb  %ds:(%rsi),(%dx)
+ 104023a:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+ 104023e:	6e                   	outsb  %ds:(%rsi),(%dx)
+ 104023f:	3e 00 66 2e          	ds add %ah,0x2e(%rsi)
+ 1040243:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+ 104024a:	00 
+ 104024b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040252:	00 00 00 
+ 1040255:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 104025c:	00 00 00 
+ 104025f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040266:	00 00 00 
+ 1040269:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040270:	00 00 00 
+ 1040273:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 104027a:	00 00 00 
+ 104027d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040284:	00 00 00 
+ 1040287:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 104028e:	00 00 00 
+ 1040291:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040298:	00 00 00 
+ 104029b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10402a2:	00 00 00 
+ 10402a5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10402ac:	00 00 00 
+ 10402af:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10402b6:	00 00 00 
+ 10402b9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10402c0:	00 00 00 
+ 10402c3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10402ca:	00 00 00 
+ 10402cd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10402d4:	00 00 00 
+ 10402d7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10402de:	00 00 00 
+ 10402e1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10402e8:	00 00 00 
+ 10402eb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10402f2:	00 00 00 
+ 10402f5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10402fc:	00 00 00 
+ 10402ff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040306:	00 00 00 
+ 1040309:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040310:	00 00 00 
+ 1040313:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 104031a:	00 00 00 
+ 104031d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040324:	00 00 00 
+ 1040327:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 104032e:	00 00 00 
+ 1040331:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040338:	00 00 00 
+ 104033b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040342:	00 00 00 
+ 1040345:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 104034c:	00 00 00 
+ 104034f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040356:	00 00 00 
+ 1040359:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040360:	00 00 00 
+ 1040363:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 104036a:	00 00 00 
+ 104036d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040374:	00 00 00 
+ 1040377:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 104037e:	00 00 00 
+ 1040381:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040388:	00 00 00 
+ 104038b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040392:	00 00 00 
+ 1040395:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 104039c:	00 00 00 
+ 104039f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10403a6:	00 00 00 
+ 10403a9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10403b0:	00 00 00 
+ 10403b3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10403ba:	00 00 00 
+ 10403bd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10403c4:	00 00 00 
+ 10403c7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10403ce:	00 00 00 
+ 10403d1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10403d8:	00 00 00 
+ 10403db:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10403e2:	00 00 00 
+ 10403e5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10403ec:	00 00 00 
+ 10403ef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10403f6:	00 00 00 
+ 10403f9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040400:	00 00 00 
+ 1040403:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 104040a:	00 00 00 
+ 104040d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040414:	00 00 00 
+ 1040417:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 104041e:	00 00 00 
+ 1040421:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040428:	00 00 00 
+ 104042b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040432:	00 00 00 
+ 1040435:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 104043c:	00 00 00 
+ 104043f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040446:	00 00 00 
+ 1040449:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040450:	00 00 00 
+ 1040453:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 104045a:	00 00 00 
+ 104045d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040464:	00 00 00 
+ 1040467:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 104046e:	00 00 00 
+ 1040471:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040478:	00 00 00 
+ 104047b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040482:	00 00 00 
+ 1040485:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 104048c:	00 00 00 
+ 104048f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040496:	00 00 00 
+ 1040499:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10404a0:	00 00 00 
+ 10404a3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10404aa:	00 00 00 
+ 10404ad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10404b4:	00 00 00 
+ 10404b7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10404be:	00 00 00 
+ 10404c1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10404c8:	00 00 00 
+ 10404cb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10404d2:	00 00 00 
+ 10404d5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10404dc:	00 00 00 
+ 10404df:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10404e6:	00 00 00 
+ 10404e9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10404f0:	00 00 00 
+ 10404f3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10404fa:	00 00 00 
+ 10404fd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040504:	00 00 00 
+ 1040507:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 104050e:	00 00 00 
+ 1040511:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040518:	00 00 00 
+ 104051b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040522:	00 00 00 
+ 1040525:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 104052c:	00 00 00 
+ 104052f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040536:	00 00 00 
+ 1040539:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040540:	00 00 00 
+ 1040543:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 104054a:	00 00 00 
+ 104054d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040554:	00 00 00 
+ 1040557:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 104055e:	00 00 00 
+ 1040561:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040568:	00 00 00 
+ 104056b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040572:	00 00 00 
+ 1040575:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 104057c:	00 00 00 
+ 104057f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040586:	00 00 00 
+ 1040589:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040590:	00 00 00 
+ 1040593:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 104059a:	00 00 00 
+ 104059d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10405a4:	00 00 00 
+ 10405a7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10405ae:	00 00 00 
+ 10405b1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10405b8:	00 00 00 
+ 10405bb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10405c2:	00 00 00 
+ 10405c5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10405cc:	00 00 00 
+ 10405cf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10405d6:	00 00 00 
+ 10405d9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10405e0:	00 00 00 
+ 10405e3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10405ea:	00 00 00 
+ 10405ed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10405f4:	00 00 00 
+ 10405f7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10405fe:	00 00 00 
+ 1040601:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040608:	00 00 00 
+ 104060b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040612:	00 00 00 
+ 1040615:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 104061c:	00 00 00 
+ 104061f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040626:	00 00 00 
+ 1040629:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040630:	00 00 00 
+ 1040633:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 104063a:	00 00 00 
+ 104063d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040644:	00 00 00 
+ 1040647:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 104064e:	00 00 00 
+ 1040651:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040658:	00 00 00 
+ 104065b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040662:	00 00 00 
+ 1040665:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 104066c:	00 00 00 
+ 104066f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040676:	00 00 00 
+ 1040679:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040680:	00 00 00 
+ 1040683:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 104068a:	00 00 00 
+ 104068d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040694:	00 00 00 
+ 1040697:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 104069e:	00 00 00 
+ 10406a1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10406a8:	00 00 00 
+ 10406ab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10406b2:	00 00 00 
+ 10406b5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10406bc:	00 00 00 
+ 10406bf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10406c6:	00 00 00 
+ 10406c9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10406d0:	00 00 00 
+ 10406d3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10406da:	00 00 00 
+ 10406dd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10406e4:	00 00 00 
+ 10406e7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10406ee:	00 00 00 
+ 10406f1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10406f8:	00 00 00 
+ 10406fb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040702:	00 00 00 
+ 1040705:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 104070c:	00 00 00 
+ 104070f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040716:	00 00 00 
+ 1040719:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040720:	00 00 00 
+ 1040723:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 104072a:	00 00 00 
+ 104072d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040734:	00 00 00 
+ 1040737:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 104073e:	00 00 00 
+ 1040741:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040748:	00 00 00 
+ 104074b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040752:	00 00 00 
+ 1040755:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 104075c:	00 00 00 
+ 104075f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040766:	00 00 00 
+ 1040769:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040770:	00 00 00 
+ 1040773:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 104077a:	00 00 00 
+ 104077d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040784:	00 00 00 
+ 1040787:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 104078e:	00 00 00 
+ 1040791:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040798:	00 00 00 
+ 104079b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10407a2:	00 00 00 
+ 10407a5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10407ac:	00 00 00 
+ 10407af:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10407b6:	00 00 00 
+ 10407b9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10407c0:	00 00 00 
+ 10407c3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10407ca:	00 00 00 
+ 10407cd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10407d4:	00 00 00 
+ 10407d7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10407de:	00 00 00 
+ 10407e1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10407e8:	00 00 00 
+ 10407eb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10407f2:	00 00 00 
+ 10407f5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10407fc:	00 00 00 
+ 10407ff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040806:	00 00 00 
+ 1040809:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040810:	00 00 00 
+ 1040813:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 104081a:	00 00 00 
+ 104081d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040824:	00 00 00 
+ 1040827:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 104082e:	00 00 00 
+ 1040831:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040838:	00 00 00 
+ 104083b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040842:	00 00 00 
+ 1040845:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 104084c:	00 00 00 
+ 104084f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040856:	00 00 00 
+ 1040859:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040860:	00 00 00 
+ 1040863:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 104086a:	00 00 00 
+ 104086d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040874:	00 00 00 
+ 1040877:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 104087e:	00 00 00 
+ 1040881:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040888:	00 00 00 
+ 104088b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040892:	00 00 00 
+ 1040895:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 104089c:	00 00 00 
+ 104089f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10408a6:	00 00 00 
+ 10408a9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10408b0:	00 00 00 
+ 10408b3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10408ba:	00 00 00 
+ 10408bd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10408c4:	00 00 00 
+ 10408c7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10408ce:	00 00 00 
+ 10408d1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10408d8:	00 00 00 
+ 10408db:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10408e2:	00 00 00 
+ 10408e5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10408ec:	00 00 00 
+ 10408ef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10408f6:	00 00 00 
+ 10408f9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040900:	00 00 00 
+ 1040903:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 104090a:	00 00 00 
+ 104090d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040914:	00 00 00 
+ 1040917:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 104091e:	00 00 00 
+ 1040921:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040928:	00 00 00 
+ 104092b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040932:	00 00 00 
+ 1040935:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 104093c:	00 00 00 
+ 104093f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040946:	00 00 00 
+ 1040949:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040950:	00 00 00 
+ 1040953:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 104095a:	00 00 00 
+ 104095d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040964:	00 00 00 
+ 1040967:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 104096e:	00 00 00 
+ 1040971:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040978:	00 00 00 
+ 104097b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040982:	00 00 00 
+ 1040985:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 104098c:	00 00 00 
+ 104098f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040996:	00 00 00 
+ 1040999:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10409a0:	00 00 00 
+ 10409a3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10409aa:	00 00 00 
+ 10409ad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10409b4:	00 00 00 
+ 10409b7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10409be:	00 00 00 
+ 10409c1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10409c8:	00 00 00 
+ 10409cb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10409d2:	00 00 00 
+ 10409d5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10409dc:	00 00 00 
+ 10409df:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10409e6:	00 00 00 
+ 10409e9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10409f0:	00 00 00 
+ 10409f3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10409fa:	00 00 00 
+ 10409fd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040a04:	00 00 00 
+ 1040a07:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040a0e:	00 00 00 
+ 1040a11:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040a18:	00 00 00 
+ 1040a1b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040a22:	00 00 00 
+ 1040a25:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040a2c:	00 00 00 
+ 1040a2f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040a36:	00 00 00 
+ 1040a39:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040a40:	00 00 00 
+ 1040a43:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040a4a:	00 00 00 
+ 1040a4d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040a54:	00 00 00 
+ 1040a57:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040a5e:	00 00 00 
+ 1040a61:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040a68:	00 00 00 
+ 1040a6b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040a72:	00 00 00 
+ 1040a75:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040a7c:	00 00 00 
+ 1040a7f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040a86:	00 00 00 
+ 1040a89:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040a90:	00 00 00 
+ 1040a93:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040a9a:	00 00 00 
+ 1040a9d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040aa4:	00 00 00 
+ 1040aa7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040aae:	00 00 00 
+ 1040ab1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040ab8:	00 00 00 
+ 1040abb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040ac2:	00 00 00 
+ 1040ac5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040acc:	00 00 00 
+ 1040acf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040ad6:	00 00 00 
+ 1040ad9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040ae0:	00 00 00 
+ 1040ae3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040aea:	00 00 00 
+ 1040aed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040af4:	00 00 00 
+ 1040af7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040afe:	00 00 00 
+ 1040b01:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040b08:	00 00 00 
+ 1040b0b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040b12:	00 00 00 
+ 1040b15:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040b1c:	00 00 00 
+ 1040b1f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040b26:	00 00 00 
+ 1040b29:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040b30:	00 00 00 
+ 1040b33:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040b3a:	00 00 00 
+ 1040b3d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040b44:	00 00 00 
+ 1040b47:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040b4e:	00 00 00 
+ 1040b51:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040b58:	00 00 00 
+ 1040b5b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040b62:	00 00 00 
+ 1040b65:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040b6c:	00 00 00 
+ 1040b6f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040b76:	00 00 00 
+ 1040b79:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040b80:	00 00 00 
+ 1040b83:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040b8a:	00 00 00 
+ 1040b8d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040b94:	00 00 00 
+ 1040b97:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040b9e:	00 00 00 
+ 1040ba1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040ba8:	00 00 00 
+ 1040bab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040bb2:	00 00 00 
+ 1040bb5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040bbc:	00 00 00 
+ 1040bbf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040bc6:	00 00 00 
+ 1040bc9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040bd0:	00 00 00 
+ 1040bd3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040bda:	00 00 00 
+ 1040bdd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040be4:	00 00 00 
+ 1040be7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040bee:	00 00 00 
+ 1040bf1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040bf8:	00 00 00 
+ 1040bfb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040c02:	00 00 00 
+ 1040c05:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040c0c:	00 00 00 
+ 1040c0f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040c16:	00 00 00 
+ 1040c19:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040c20:	00 00 00 
+ 1040c23:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040c2a:	00 00 00 
+ 1040c2d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040c34:	00 00 00 
+ 1040c37:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040c3e:	00 00 00 
+ 1040c41:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040c48:	00 00 00 
+ 1040c4b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040c52:	00 00 00 
+ 1040c55:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040c5c:	00 00 00 
+ 1040c5f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040c66:	00 00 00 
+ 1040c69:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040c70:	00 00 00 
+ 1040c73:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040c7a:	00 00 00 
+ 1040c7d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040c84:	00 00 00 
+ 1040c87:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040c8e:	00 00 00 
+ 1040c91:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040c98:	00 00 00 
+ 1040c9b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040ca2:	00 00 00 
+ 1040ca5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040cac:	00 00 00 
+ 1040caf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040cb6:	00 00 00 
+ 1040cb9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040cc0:	00 00 00 
+ 1040cc3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040cca:	00 00 00 
+ 1040ccd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040cd4:	00 00 00 
+ 1040cd7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040cde:	00 00 00 
+ 1040ce1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040ce8:	00 00 00 
+ 1040ceb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040cf2:	00 00 00 
+ 1040cf5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040cfc:	00 00 00 
+ 1040cff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040d06:	00 00 00 
+ 1040d09:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040d10:	00 00 00 
+ 1040d13:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040d1a:	00 00 00 
+ 1040d1d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040d24:	00 00 00 
+ 1040d27:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040d2e:	00 00 00 
+ 1040d31:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040d38:	00 00 00 
+ 1040d3b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040d42:	00 00 00 
+ 1040d45:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040d4c:	00 00 00 
+ 1040d4f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040d56:	00 00 00 
+ 1040d59:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040d60:	00 00 00 
+ 1040d63:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040d6a:	00 00 00 
+ 1040d6d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040d74:	00 00 00 
+ 1040d77:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040d7e:	00 00 00 
+ 1040d81:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040d88:	00 00 00 
+ 1040d8b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040d92:	00 00 00 
+ 1040d95:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040d9c:	00 00 00 
+ 1040d9f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040da6:	00 00 00 
+ 1040da9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040db0:	00 00 00 
+ 1040db3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040dba:	00 00 00 
+ 1040dbd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040dc4:	00 00 00 
+ 1040dc7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040dce:	00 00 00 
+ 1040dd1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040dd8:	00 00 00 
+ 1040ddb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040de2:	00 00 00 
+ 1040de5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040dec:	00 00 00 
+ 1040def:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040df6:	00 00 00 
+ 1040df9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040e00:	00 00 00 
+ 1040e03:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040e0a:	00 00 00 
+ 1040e0d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040e14:	00 00 00 
+ 1040e17:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040e1e:	00 00 00 
+ 1040e21:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040e28:	00 00 00 
+ 1040e2b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040e32:	00 00 00 
+ 1040e35:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040e3c:	00 00 00 
+ 1040e3f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040e46:	00 00 00 
+ 1040e49:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040e50:	00 00 00 
+ 1040e53:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040e5a:	00 00 00 
+ 1040e5d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040e64:	00 00 00 
+ 1040e67:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040e6e:	00 00 00 
+ 1040e71:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040e78:	00 00 00 
+ 1040e7b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040e82:	00 00 00 
+ 1040e85:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040e8c:	00 00 00 
+ 1040e8f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040e96:	00 00 00 
+ 1040e99:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040ea0:	00 00 00 
+ 1040ea3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040eaa:	00 00 00 
+ 1040ead:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040eb4:	00 00 00 
+ 1040eb7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040ebe:	00 00 00 
+ 1040ec1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040ec8:	00 00 00 
+ 1040ecb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040ed2:	00 00 00 
+ 1040ed5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040edc:	00 00 00 
+ 1040edf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040ee6:	00 00 00 
+ 1040ee9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040ef0:	00 00 00 
+ 1040ef3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040efa:	00 00 00 
+ 1040efd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040f04:	00 00 00 
+ 1040f07:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040f0e:	00 00 00 
+ 1040f11:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040f18:	00 00 00 
+ 1040f1b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040f22:	00 00 00 
+ 1040f25:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040f2c:	00 00 00 
+ 1040f2f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040f36:	00 00 00 
+ 1040f39:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040f40:	00 00 00 
+ 1040f43:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040f4a:	00 00 00 
+ 1040f4d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040f54:	00 00 00 
+ 1040f57:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040f5e:	00 00 00 
+ 1040f61:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040f68:	00 00 00 
+ 1040f6b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040f72:	00 00 00 
+ 1040f75:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040f7c:	00 00 00 
+ 1040f7f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040f86:	00 00 00 
+ 1040f89:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040f90:	00 00 00 
+ 1040f93:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040f9a:	00 00 00 
+ 1040f9d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040fa4:	00 00 00 
+ 1040fa7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040fae:	00 00 00 
+ 1040fb1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040fb8:	00 00 00 
+ 1040fbb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040fc2:	00 00 00 
+ 1040fc5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040fcc:	00 00 00 
+ 1040fcf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040fd6:	00 00 00 
+ 1040fd9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040fe0:	00 00 00 
+ 1040fe3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040fea:	00 00 00 
+ 1040fed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1040ff4:	00 00 00 
+ 1040ff7:	66 0f 1f 84 00 00 00 	nopw   0x0(%rax,%rax,1)
+ 1040ffe:	00 00 
@@ -0,0 +1,992 @@
+
+obj/prog/test6:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000001050000 <_start>:
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+ 1050000:	6a 00                	push   $0x0
+    pushq $0
+ 1050002:	6a 00                	push   $0x0
+
+0000000001050004 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+ 1050004:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+ 1050009:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+ 105000d:	31 ed                	xor    %ebp,%ebp
+    call libmain
+ 105000f:	e8 9b 01 00 00       	call   10501af <libmain>
+    jmp .
+ 1050014:	eb fe                	jmp    1050014 <args_exist+0x10>
+
+0000000001050016 <test_rec>:
+void (*volatile sys_yield)(void);
+
+unsigned int deep = 0;
+
+void
+test_rec(void) {
+ 1050016:	55                   	push   %rbp
+ 1050017:	48 89 e5             	mov    %rsp,%rbp
+ 105001a:	53                   	push   %rbx
+ 105001b:	48 83 ec 08          	sub    $0x8,%rsp
+    void *buf;
+    ++deep;
+ 105001f:	48 b8 a8 10 05 01 00 	movabs $0x10510a8,%rax
+ 1050026:	00 00 00 
+ 1050029:	83 00 01             	addl   $0x1,(%rax)
+
+    if (!(rand() % 47)) {
+ 105002c:	48 b8 de 01 05 01 00 	movabs $0x10501de,%rax
+ 1050033:	00 00 00 
+ 1050036:	ff d0                	call   *%rax
+ 1050038:	48 63 d0             	movslq %eax,%rdx
+ 105003b:	48 69 d2 5d 41 4c ae 	imul   $0xffffffffae4c415d,%rdx,%rdx
+ 1050042:	48 c1 ea 20          	shr    $0x20,%rdx
+ 1050046:	01 c2                	add    %eax,%edx
+ 1050048:	c1 fa 05             	sar    $0x5,%edx
+ 105004b:	89 c1                	mov    %eax,%ecx
+ 105004d:	c1 f9 1f             	sar    $0x1f,%ecx
+ 1050050:	29 ca                	sub    %ecx,%edx
+ 1050052:	6b d2 2f             	imul   $0x2f,%edx,%edx
+ 1050055:	39 d0                	cmp    %edx,%eax
+ 1050057:	75 0c                	jne    1050065 <test_rec+0x4f>
+        sys_yield();
+ 1050059:	48 a1 b0 10 05 01 00 	movabs 0x10510b0,%rax
+ 1050060:	00 00 00 
+ 1050063:	ff d0                	call   *%rax
+    }
+
+    buf = test_alloc(rand() % 200);
+ 1050065:	48 b8 c0 10 05 01 00 	movabs $0x10510c0,%rax
+ 105006c:	00 00 00 
+ 105006f:	48 8b 18             	mov    (%rax),%rbx
+ 1050072:	48 b8 de 01 05 01 00 	movabs $0x10501de,%rax
+ 1050079:	00 00 00 
+ 105007c:	ff d0                	call   *%rax
+ 105007e:	48 63 d0             	movslq %eax,%rdx
+ 1050081:	48 69 d2 1f 85 eb 51 	imul   $0x51eb851f,%rdx,%rdx
+ 1050088:	48 c1 fa 26          	sar    $0x26,%rdx
+ 105008c:	89 c1                	mov    %eax,%ecx
+ 105008e:	c1 f9 1f             	sar    $0x1f,%ecx
+ 1050091:	29 ca                	sub    %ecx,%edx
+ 1050093:	69 d2 c8 00 00 00    	imul   $0xc8,%edx,%edx
+ 1050099:	29 d0                	sub    %edx,%eax
+ 105009b:	0f b6 f8             	movzbl %al,%edi
+ 105009e:	ff d3                	call   *%rbx
+ 10500a0:	48 89 c3             	mov    %rax,%rbx
+    if (buf) {
+ 10500a3:	48 85 c0             	test   %rax,%rax
+ 10500a6:	74 6d                	je     1050115 <test_rec+0xff>
+        if (deep <= 173 && (rand() % 41)) {
+ 10500a8:	48 b8 a8 10 05 01 00 	movabs $0x10510a8,%rax
+ 10500af:	00 00 00 
+ 10500b2:	81 38 ad 00 00 00    	cmpl   $0xad,(%rax)
+ 10500b8:	76 22                	jbe    10500dc <test_rec+0xc6>
+            test_rec();
+        }
+        test_free(buf);
+ 10500ba:	48 a1 b8 10 05 01 00 	movabs 0x10510b8,%rax
+ 10500c1:	00 00 00 
+ 10500c4:	48 89 df             	mov    %rbx,%rdi
+ 10500c7:	ff d0                	call   *%rax
+        if (deep <= 173 && (rand() % 29)) {
+            test_rec();
+        }
+    }
+
+    --deep;
+ 10500c9:	48 b8 a8 10 05 01 00 	movabs $0x10510a8,%rax
+ 10500d0:	00 00 00 
+ 10500d3:	83 28 01             	subl   $0x1,(%rax)
+    return;
+}
+ 10500d6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+ 10500da:	c9                   	leave
+ 10500db:	c3                   	ret
+        if (deep <= 173 && (rand() % 41)) {
+ 10500dc:	48 b8 de 01 05 01 00 	movabs $0x10501de,%rax
+ 10500e3:	00 00 00 
+ 10500e6:	ff d0                	call   *%rax
+ 10500e8:	48 63 d0             	movslq %eax,%rdx
+ 10500eb:	48 69 d2 3f 06 e7 63 	imul   $0x63e7063f,%rdx,%rdx
+ 10500f2:	48 c1 fa 24          	sar    $0x24,%rdx
+ 10500f6:	89 c1                	mov    %eax,%ecx
+ 10500f8:	c1 f9 1f             	sar    $0x1f,%ecx
+ 10500fb:	29 ca                	sub    %ecx,%edx
+ 10500fd:	8d 0c 92             	lea    (%rdx,%rdx,4),%ecx
+ 1050100:	8d 14 ca             	lea    (%rdx,%rcx,8),%edx
+ 1050103:	39 d0                	cmp    %edx,%eax
+ 1050105:	74 b3                	je     10500ba <test_rec+0xa4>
+            test_rec();
+ 1050107:	48 b8 16 00 05 01 00 	movabs $0x1050016,%rax
+ 105010e:	00 00 00 
+ 1050111:	ff d0                	call   *%rax
+ 1050113:	eb a5                	jmp    10500ba <test_rec+0xa4>
+        if (deep <= 173 && (rand() % 29)) {
+ 1050115:	48 b8 a8 10 05 01 00 	movabs $0x10510a8,%rax
+ 105011c:	00 00 00 
+ 105011f:	81 38 ad 00 00 00    	cmpl   $0xad,(%rax)
+ 1050125:	77 a2                	ja     10500c9 <test_rec+0xb3>
+ 1050127:	48 b8 de 01 05 01 00 	movabs $0x10501de,%rax
+ 105012e:	00 00 00 
+ 1050131:	ff d0                	call   *%rax
+ 1050133:	48 63 d0             	movslq %eax,%rdx
+ 1050136:	48 69 d2 09 cb 3d 8d 	imul   $0xffffffff8d3dcb09,%rdx,%rdx
+ 105013d:	48 c1 ea 20          	shr    $0x20,%rdx
+ 1050141:	01 c2                	add    %eax,%edx
+ 1050143:	c1 fa 04             	sar    $0x4,%edx
+ 1050146:	89 c1                	mov    %eax,%ecx
+ 1050148:	c1 f9 1f             	sar    $0x1f,%ecx
+ 105014b:	29 ca                	sub    %ecx,%edx
+ 105014d:	6b d2 1d             	imul   $0x1d,%edx,%edx
+ 1050150:	39 d0                	cmp    %edx,%eax
+ 1050152:	0f 84 71 ff ff ff    	je     10500c9 <test_rec+0xb3>
+            test_rec();
+ 1050158:	48 b8 16 00 05 01 00 	movabs $0x1050016,%rax
+ 105015f:	00 00 00 
+ 1050162:	ff d0                	call   *%rax
+ 1050164:	e9 60 ff ff ff       	jmp    10500c9 <test_rec+0xb3>
+
+0000000001050169 <umain>:
+
+void
+umain(int argc, char **argv) {
+ 1050169:	55                   	push   %rbp
+ 105016a:	48 89 e5             	mov    %rsp,%rbp
+ 105016d:	53                   	push   %rbx
+ 105016e:	48 83 ec 08          	sub    $0x8,%rsp
+    #if !defined(GRADE3_TEST)
+    cprintf("TEST6 LOADED.\n");
+ 1050172:	48 b8 c8 10 05 01 00 	movabs $0x10510c8,%rax
+ 1050179:	00 00 00 
+ 105017c:	48 8b 10             	mov    (%rax),%rdx
+ 105017f:	48 bf 38 02 05 01 00 	movabs $0x1050238,%rdi
+ 1050186:	00 00 00 
+ 1050189:	b8 00 00 00 00       	mov    $0x0,%eax
+ 105018e:	ff d2                	call   *%rdx
+    #endif
+
+    rand_init(5);
+ 1050190:	bf 05 00 00 00       	mov    $0x5,%edi
+ 1050195:	48 b8 07 02 05 01 00 	movabs $0x1050207,%rax
+ 105019c:	00 00 00 
+ 105019f:	ff d0                	call   *%rax
+    for (;;) {
+        test_rec();
+ 10501a1:	48 bb 16 00 05 01 00 	movabs $0x1050016,%rbx
+ 10501a8:	00 00 00 
+ 10501ab:	ff d3                	call   *%rbx
+    for (;;) {
+ 10501ad:	eb fc                	jmp    10501ab <umain+0x42>
+
+00000000010501af <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+ 10501af:	55                   	push   %rbp
+ 10501b0:	48 89 e5             	mov    %rsp,%rbp
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+ 10501b3:	85 ff                	test   %edi,%edi
+ 10501b5:	7e 0d                	jle    10501c4 <libmain+0x15>
+ 10501b7:	48 8b 06             	mov    (%rsi),%rax
+ 10501ba:	48 a3 00 10 05 01 00 	movabs %rax,0x1051000
+ 10501c1:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+ 10501c4:	48 b8 69 01 05 01 00 	movabs $0x1050169,%rax
+ 10501cb:	00 00 00 
+ 10501ce:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+ 10501d0:	48 a1 d0 10 05 01 00 	movabs 0x10510d0,%rax
+ 10501d7:	00 00 00 
+ 10501da:	ff d0                	call   *%rax
+#endif
+}
+ 10501dc:	5d                   	pop    %rbp
+ 10501dd:	c3                   	ret
+
+00000000010501de <rand>:
+
+static unsigned int next = 1;
+
+static int
+rand_r(unsigned int *seed) {
+    *seed = *seed * 1103515245 + 12345;
+ 10501de:	48 ba 08 10 05 01 00 	movabs $0x1051008,%rdx
+ 10501e5:	00 00 00 
+ 10501e8:	69 02 6d 4e c6 41    	imul   $0x41c64e6d,(%rdx),%eax
+ 10501ee:	05 39 30 00 00       	add    $0x3039,%eax
+ 10501f3:	89 02                	mov    %eax,(%rdx)
+    return (*seed % ((unsigned int)RAND_MAX + 1));
+ 10501f5:	25 ff ff ff 7f       	and    $0x7fffffff,%eax
+}
+
+int
+rand(void) {
+    return (rand_r(&next));
+}
+ 10501fa:	c3                   	ret
+
+00000000010501fb <srand>:
+
+void
+srand(unsigned int seed) {
+    next = seed;
+ 10501fb:	89 f8                	mov    %edi,%eax
+ 10501fd:	a3 08 10 05 01 00 00 	movabs %eax,0x1051008
+ 1050204:	00 00 
+}
+ 1050206:	c3                   	ret
+
+0000000001050207 <rand_init>:
+
+void
+rand_init(unsigned int num) {
+ 1050207:	89 f8                	mov    %edi,%eax
+    srand(((unsigned int *)_dev_urandom)[num % _dev_urandom_len]);
+ 1050209:	48 b9 20 10 05 01 00 	movabs $0x1051020,%rcx
+ 1050210:	00 00 00 
+ 1050213:	ba 00 00 00 00       	mov    $0x0,%edx
+ 1050218:	f7 31                	divl   (%rcx)
+    next = seed;
+ 105021a:	48 b8 40 10 05 01 00 	movabs $0x1051040,%rax
+ 1050221:	00 00 00 
+ 1050224:	8b 04 90             	mov    (%rax,%rdx,4),%eax
+ 1050227:	a3 08 10 05 01 00 00 	movabs %eax,0x1051008
+ 105022e:	00 00 
+}
+ 1050230:	c3                   	ret
+ 1050231:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+ 1050238:	54                   	push   %rsp
+ 1050239:	45 53                	rex.RB push %r11
+ 105023b:	54                   	push   %rsp
+ 105023c:	36 20 4c 4f 41       	ss and %cl,0x41(%rdi,%rcx,2)
+ 1050241:	44                   	rex.R
+ 1050242:	45                   	rex.RB
+ 1050243:	44                   	rex.R
+ 1050244:	2e 0a 00             	cs or  (%rax),%al
+ 1050247:	3c 75                	cmp    $0x75,%al
+ 1050249:	6e                   	outsb  %ds:(%rsi),(%dx)
+ 105024a:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+ 105024e:	6e                   	outsb  %ds:(%rsi),(%dx)
+ 105024f:	3e 00 66 2e          	ds add %ah,0x2e(%rsi)
+ 1050253:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+ 105025a:	00 
+ 105025b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050262:	00 00 00 
+ 1050265:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 105026c:	00 00 00 
+ 105026f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050276:	00 00 00 
+ 1050279:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050280:	00 00 00 
+ 1050283:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 105028a:	00 00 00 
+ 105028d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050294:	00 00 00 
+ 1050297:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 105029e:	00 00 00 
+ 10502a1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10502a8:	00 00 00 
+ 10502ab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10502b2:	00 00 00 
+ 10502b5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10502bc:	00 00 00 
+ 10502bf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10502c6:	00 00 00 
+ 10502c9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10502d0:	00 00 00 
+ 10502d3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10502da:	00 00 00 
+ 10502dd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10502e4:	00 00 00 
+ 10502e7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10502ee:	00 00 00 
+ 10502f1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10502f8:	00 00 00 
+ 10502fb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050302:	00 00 00 
+ 1050305:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 105030c:	00 00 00 
+ 105030f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050316:	00 00 00 
+ 1050319:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050320:	00 00 00 
+ 1050323:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 105032a:	00 00 00 
+ 105032d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050334:	00 00 00 
+ 1050337:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 105033e:	00 00 00 
+ 1050341:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050348:	00 00 00 
+ 105034b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050352:	00 00 00 
+ 1050355:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 105035c:	00 00 00 
+ 105035f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050366:	00 00 00 
+ 1050369:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050370:	00 00 00 
+ 1050373:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 105037a:	00 00 00 
+ 105037d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050384:	00 00 00 
+ 1050387:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 105038e:	00 00 00 
+ 1050391:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050398:	00 00 00 
+ 105039b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10503a2:	00 00 00 
+ 10503a5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10503ac:	00 00 00 
+ 10503af:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10503b6:	00 00 00 
+ 10503b9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10503c0:	00 00 00 
+ 10503c3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10503ca:	00 00 00 
+ 10503cd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10503d4:	00 00 00 
+ 10503d7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10503de:	00 00 00 
+ 10503e1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10503e8:	00 00 00 
+ 10503eb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10503f2:	00 00 00 
+ 10503f5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10503fc:	00 00 00 
+ 10503ff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050406:	00 00 00 
+ 1050409:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050410:	00 00 00 
+ 1050413:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 105041a:	00 00 00 
+ 105041d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050424:	00 00 00 
+ 1050427:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 105042e:	00 00 00 
+ 1050431:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050438:	00 00 00 
+ 105043b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050442:	00 00 00 
+ 1050445:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 105044c:	00 00 00 
+ 105044f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050456:	00 00 00 
+ 1050459:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050460:	00 00 00 
+ 1050463:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 105046a:	00 00 00 
+ 105046d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050474:	00 00 00 
+ 1050477:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 105047e:	00 00 00 
+ 1050481:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050488:	00 00 00 
+ 105048b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050492:	00 00 00 
+ 1050495:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 105049c:	00 00 00 
+ 105049f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10504a6:	00 00 00 
+ 10504a9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10504b0:	00 00 00 
+ 10504b3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10504ba:	00 00 00 
+ 10504bd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10504c4:	00 00 00 
+ 10504c7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10504ce:	00 00 00 
+ 10504d1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10504d8:	00 00 00 
+ 10504db:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10504e2:	00 00 00 
+ 10504e5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10504ec:	00 00 00 
+ 10504ef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10504f6:	00 00 00 
+ 10504f9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050500:	00 00 00 
+ 1050503:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 105050a:	00 00 00 
+ 105050d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050514:	00 00 00 
+ 1050517:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 105051e:	00 00 00 
+ 1050521:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050528:	00 00 00 
+ 105052b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050532:	00 00 00 
+ 1050535:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 105053c:	00 00 00 
+ 105053f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050546:	00 00 00 
+ 1050549:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050550:	00 00 00 
+ 1050553:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 105055a:	00 00 00 
+ 105055d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050564:	00 00 00 
+ 1050567:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 105056e:	00 00 00 
+ 1050571:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050578:	00 00 00 
+ 105057b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050582:	00 00 00 
+ 1050585:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 105058c:	00 00 00 
+ 105058f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050596:	00 00 00 
+ 1050599:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10505a0:	00 00 00 
+ 10505a3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10505aa:	00 00 00 
+ 10505ad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10505b4:	00 00 00 
+ 10505b7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10505be:	00 00 00 
+ 10505c1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10505c8:	00 00 00 
+ 10505cb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10505d2:	00 00 00 
+ 10505d5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10505dc:	00 00 00 
+ 10505df:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10505e6:	00 00 00 
+ 10505e9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10505f0:	00 00 00 
+ 10505f3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10505fa:	00 00 00 
+ 10505fd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050604:	00 00 00 
+ 1050607:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 105060e:	00 00 00 
+ 1050611:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050618:	00 00 00 
+ 105061b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050622:	00 00 00 
+ 1050625:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 105062c:	00 00 00 
+ 105062f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050636:	00 00 00 
+ 1050639:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050640:	00 00 00 
+ 1050643:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 105064a:	00 00 00 
+ 105064d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050654:	00 00 00 
+ 1050657:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 105065e:	00 00 00 
+ 1050661:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050668:	00 00 00 
+ 105066b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050672:	00 00 00 
+ 1050675:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 105067c:	00 00 00 
+ 105067f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050686:	00 00 00 
+ 1050689:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050690:	00 00 00 
+ 1050693:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 105069a:	00 00 00 
+ 105069d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10506a4:	00 00 00 
+ 10506a7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10506ae:	00 00 00 
+ 10506b1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10506b8:	00 00 00 
+ 10506bb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10506c2:	00 00 00 
+ 10506c5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10506cc:	00 00 00 
+ 10506cf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10506d6:	00 00 00 
+ 10506d9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10506e0:	00 00 00 
+ 10506e3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10506ea:	00 00 00 
+ 10506ed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10506f4:	00 00 00 
+ 10506f7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10506fe:	00 00 00 
+ 1050701:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050708:	00 00 00 
+ 105070b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050712:	00 00 00 
+ 1050715:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 105071c:	00 00 00 
+ 105071f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050726:	00 00 00 
+ 1050729:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050730:	00 00 00 
+ 1050733:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 105073a:	00 00 00 
+ 105073d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050744:	00 00 00 
+ 1050747:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 105074e:	00 00 00 
+ 1050751:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050758:	00 00 00 
+ 105075b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050762:	00 00 00 
+ 1050765:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 105076c:	00 00 00 
+ 105076f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050776:	00 00 00 
+ 1050779:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050780:	00 00 00 
+ 1050783:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 105078a:	00 00 00 
+ 105078d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050794:	00 00 00 
+ 1050797:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 105079e:	00 00 00 
+ 10507a1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10507a8:	00 00 00 
+ 10507ab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10507b2:	00 00 00 
+ 10507b5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10507bc:	00 00 00 
+ 10507bf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10507c6:	00 00 00 
+ 10507c9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10507d0:	00 00 00 
+ 10507d3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10507da:	00 00 00 
+ 10507dd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10507e4:	00 00 00 
+ 10507e7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10507ee:	00 00 00 
+ 10507f1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10507f8:	00 00 00 
+ 10507fb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050802:	00 00 00 
+ 1050805:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 105080c:	00 00 00 
+ 105080f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050816:	00 00 00 
+ 1050819:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050820:	00 00 00 
+ 1050823:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 105082a:	00 00 00 
+ 105082d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050834:	00 00 00 
+ 1050837:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 105083e:	00 00 00 
+ 1050841:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050848:	00 00 00 
+ 105084b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050852:	00 00 00 
+ 1050855:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 105085c:	00 00 00 
+ 105085f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050866:	00 00 00 
+ 1050869:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050870:	00 00 00 
+ 1050873:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 105087a:	00 00 00 
+ 105087d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050884:	00 00 00 
+ 1050887:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 105088e:	00 00 00 
+ 1050891:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050898:	00 00 00 
+ 105089b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10508a2:	00 00 00 
+ 10508a5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10508ac:	00 00 00 
+ 10508af:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10508b6:	00 00 00 
+ 10508b9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10508c0:	00 00 00 
+ 10508c3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10508ca:	00 00 00 
+ 10508cd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10508d4:	00 00 00 
+ 10508d7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10508de:	00 00 00 
+ 10508e1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10508e8:	00 00 00 
+ 10508eb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10508f2:	00 00 00 
+ 10508f5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10508fc:	00 00 00 
+ 10508ff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050906:	00 00 00 
+ 1050909:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050910:	00 00 00 
+ 1050913:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 105091a:	00 00 00 
+ 105091d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050924:	00 00 00 
+ 1050927:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 105092e:	00 00 00 
+ 1050931:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050938:	00 00 00 
+ 105093b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050942:	00 00 00 
+ 1050945:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 105094c:	00 00 00 
+ 105094f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050956:	00 00 00 
+ 1050959:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050960:	00 00 00 
+ 1050963:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 105096a:	00 00 00 
+ 105096d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050974:	00 00 00 
+ 1050977:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 105097e:	00 00 00 
+ 1050981:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050988:	00 00 00 
+ 105098b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050992:	00 00 00 
+ 1050995:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 105099c:	00 00 00 
+ 105099f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10509a6:	00 00 00 
+ 10509a9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10509b0:	00 00 00 
+ 10509b3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10509ba:	00 00 00 
+ 10509bd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10509c4:	00 00 00 
+ 10509c7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10509ce:	00 00 00 
+ 10509d1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10509d8:	00 00 00 
+ 10509db:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10509e2:	00 00 00 
+ 10509e5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10509ec:	00 00 00 
+ 10509ef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 10509f6:	00 00 00 
+ 10509f9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050a00:	00 00 00 
+ 1050a03:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050a0a:	00 00 00 
+ 1050a0d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050a14:	00 00 00 
+ 1050a17:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050a1e:	00 00 00 
+ 1050a21:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050a28:	00 00 00 
+ 1050a2b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050a32:	00 00 00 
+ 1050a35:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050a3c:	00 00 00 
+ 1050a3f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050a46:	00 00 00 
+ 1050a49:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050a50:	00 00 00 
+ 1050a53:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050a5a:	00 00 00 
+ 1050a5d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050a64:	00 00 00 
+ 1050a67:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050a6e:	00 00 00 
+ 1050a71:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050a78:	00 00 00 
+ 1050a7b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050a82:	00 00 00 
+ 1050a85:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050a8c:	00 00 00 
+ 1050a8f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050a96:	00 00 00 
+ 1050a99:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050aa0:	00 00 00 
+ 1050aa3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050aaa:	00 00 00 
+ 1050aad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050ab4:	00 00 00 
+ 1050ab7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050abe:	00 00 00 
+ 1050ac1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050ac8:	00 00 00 
+ 1050acb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050ad2:	00 00 00 
+ 1050ad5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050adc:	00 00 00 
+ 1050adf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050ae6:	00 00 00 
+ 1050ae9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050af0:	00 00 00 
+ 1050af3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050afa:	00 00 00 
+ 1050afd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050b04:	00 00 00 
+ 1050b07:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050b0e:	00 00 00 
+ 1050b11:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050b18:	00 00 00 
+ 1050b1b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050b22:	00 00 00 
+ 1050b25:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050b2c:	00 00 00 
+ 1050b2f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050b36:	00 00 00 
+ 1050b39:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050b40:	00 00 00 
+ 1050b43:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050b4a:	00 00 00 
+ 1050b4d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050b54:	00 00 00 
+ 1050b57:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050b5e:	00 00 00 
+ 1050b61:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050b68:	00 00 00 
+ 1050b6b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050b72:	00 00 00 
+ 1050b75:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050b7c:	00 00 00 
+ 1050b7f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050b86:	00 00 00 
+ 1050b89:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050b90:	00 00 00 
+ 1050b93:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050b9a:	00 00 00 
+ 1050b9d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050ba4:	00 00 00 
+ 1050ba7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050bae:	00 00 00 
+ 1050bb1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050bb8:	00 00 00 
+ 1050bbb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050bc2:	00 00 00 
+ 1050bc5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050bcc:	00 00 00 
+ 1050bcf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050bd6:	00 00 00 
+ 1050bd9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050be0:	00 00 00 
+ 1050be3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050bea:	00 00 00 
+ 1050bed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050bf4:	00 00 00 
+ 1050bf7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050bfe:	00 00 00 
+ 1050c01:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050c08:	00 00 00 
+ 1050c0b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050c12:	00 00 00 
+ 1050c15:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050c1c:	00 00 00 
+ 1050c1f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050c26:	00 00 00 
+ 1050c29:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050c30:	00 00 00 
+ 1050c33:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050c3a:	00 00 00 
+ 1050c3d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050c44:	00 00 00 
+ 1050c47:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050c4e:	00 00 00 
+ 1050c51:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050c58:	00 00 00 
+ 1050c5b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050c62:	00 00 00 
+ 1050c65:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050c6c:	00 00 00 
+ 1050c6f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050c76:	00 00 00 
+ 1050c79:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050c80:	00 00 00 
+ 1050c83:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050c8a:	00 00 00 
+ 1050c8d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050c94:	00 00 00 
+ 1050c97:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050c9e:	00 00 00 
+ 1050ca1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050ca8:	00 00 00 
+ 1050cab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050cb2:	00 00 00 
+ 1050cb5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050cbc:	00 00 00 
+ 1050cbf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050cc6:	00 00 00 
+ 1050cc9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050cd0:	00 00 00 
+ 1050cd3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050cda:	00 00 00 
+ 1050cdd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050ce4:	00 00 00 
+ 1050ce7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050cee:	00 00 00 
+ 1050cf1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050cf8:	00 00 00 
+ 1050cfb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050d02:	00 00 00 
+ 1050d05:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050d0c:	00 00 00 
+ 1050d0f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050d16:	00 00 00 
+ 1050d19:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050d20:	00 00 00 
+ 1050d23:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050d2a:	00 00 00 
+ 1050d2d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050d34:	00 00 00 
+ 1050d37:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050d3e:	00 00 00 
+ 1050d41:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050d48:	00 00 00 
+ 1050d4b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050d52:	00 00 00 
+ 1050d55:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050d5c:	00 00 00 
+ 1050d5f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050d66:	00 00 00 
+ 1050d69:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050d70:	00 00 00 
+ 1050d73:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050d7a:	00 00 00 
+ 1050d7d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050d84:	00 00 00 
+ 1050d87:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050d8e:	00 00 00 
+ 1050d91:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050d98:	00 00 00 
+ 1050d9b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050da2:	00 00 00 
+ 1050da5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050dac:	00 00 00 
+ 1050daf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050db6:	00 00 00 
+ 1050db9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050dc0:	00 00 00 
+ 1050dc3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050dca:	00 00 00 
+ 1050dcd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050dd4:	00 00 00 
+ 1050dd7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050dde:	00 00 00 
+ 1050de1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050de8:	00 00 00 
+ 1050deb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050df2:	00 00 00 
+ 1050df5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050dfc:	00 00 00 
+ 1050dff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050e06:	00 00 00 
+ 1050e09:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050e10:	00 00 00 
+ 1050e13:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050e1a:	00 00 00 
+ 1050e1d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050e24:	00 00 00 
+ 1050e27:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050e2e:	00 00 00 
+ 1050e31:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050e38:	00 00 00 
+ 1050e3b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050e42:	00 00 00 
+ 1050e45:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050e4c:	00 00 00 
+ 1050e4f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050e56:	00 00 00 
+ 1050e59:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050e60:	00 00 00 
+ 1050e63:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050e6a:	00 00 00 
+ 1050e6d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050e74:	00 00 00 
+ 1050e77:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050e7e:	00 00 00 
+ 1050e81:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050e88:	00 00 00 
+ 1050e8b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050e92:	00 00 00 
+ 1050e95:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050e9c:	00 00 00 
+ 1050e9f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050ea6:	00 00 00 
+ 1050ea9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050eb0:	00 00 00 
+ 1050eb3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050eba:	00 00 00 
+ 1050ebd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050ec4:	00 00 00 
+ 1050ec7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050ece:	00 00 00 
+ 1050ed1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050ed8:	00 00 00 
+ 1050edb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050ee2:	00 00 00 
+ 1050ee5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050eec:	00 00 00 
+ 1050eef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050ef6:	00 00 00 
+ 1050ef9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050f00:	00 00 00 
+ 1050f03:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050f0a:	00 00 00 
+ 1050f0d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050f14:	00 00 00 
+ 1050f17:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050f1e:	00 00 00 
+ 1050f21:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050f28:	00 00 00 
+ 1050f2b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050f32:	00 00 00 
+ 1050f35:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050f3c:	00 00 00 
+ 1050f3f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050f46:	00 00 00 
+ 1050f49:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050f50:	00 00 00 
+ 1050f53:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050f5a:	00 00 00 
+ 1050f5d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050f64:	00 00 00 
+ 1050f67:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050f6e:	00 00 00 
+ 1050f71:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050f78:	00 00 00 
+ 1050f7b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050f82:	00 00 00 
+ 1050f85:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050f8c:	00 00 00 
+ 1050f8f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050f96:	00 00 00 
+ 1050f99:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050fa0:	00 00 00 
+ 1050fa3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050faa:	00 00 00 
+ 1050fad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050fb4:	00 00 00 
+ 1050fb7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050fbe:	00 00 00 
+ 1050fc1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050fc8:	00 00 00 
+ 1050fcb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050fd2:	00 00 00 
+ 1050fd5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050fdc:	00 00 00 
+ 1050fdf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050fe6:	00 00 00 
+ 1050fe9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050ff0:	00 00 00 
+ 1050ff3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+ 1050ffa:	00 00 00 
+ 1050ffd:	0f 1f 00             	nopl   (%rax)